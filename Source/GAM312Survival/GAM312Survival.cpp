@@ -3,4 +3,39 @@
 #include "GAM312Survival.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogGAM312Survival);
+
+UE_TRACE_CHANNEL_DEFINE(GAM312SurvivalChannel);
+
+DEFINE_STAT(STAT_SurvivalInteraction);
+DEFINE_STAT(STAT_SurvivalInteractableQuery);
+DEFINE_STAT(STAT_SurvivalBuildPreview);
+DEFINE_STAT(STAT_SurvivalStats);
+DEFINE_STAT(STAT_SurvivalBerryRegrowth);
+DEFINE_STAT(STAT_SurvivalResourceState);
+DEFINE_STAT(STAT_SurvivalButterflyTick);
+DEFINE_STAT(STAT_SurvivalButterflySprites);
+DEFINE_STAT(STAT_SurvivalWanderScheduler);
+DEFINE_STAT(STAT_SurvivalWidgetRefresh);
+DEFINE_STAT(STAT_SurvivalSignificance);
+DEFINE_STAT(STAT_SurvivalStructuralIntegrity);
+DEFINE_STAT(STAT_SurvivalResourceRespawn);
+
+DEFINE_STAT(STAT_SurvivalResourceStateSwaps);
+DEFINE_STAT(STAT_SurvivalPreviewTraces);
+DEFINE_STAT(STAT_SurvivalWidgetRefreshes);
+
+DEFINE_STAT(STAT_SurvivalRegrowingBushes);
+DEFINE_STAT(STAT_SurvivalActiveButterflies);
+DEFINE_STAT(STAT_SurvivalSurvivors);
+DEFINE_STAT(STAT_SurvivalInteractables);
+DEFINE_STAT(STAT_SurvivalCompactedStructures);
+DEFINE_STAT(STAT_SurvivalStructureSlots);
+DEFINE_STAT(STAT_SurvivalCollapsedStructures);
+DEFINE_STAT(STAT_SurvivalPendingRespawns);
+DEFINE_STAT(STAT_SurvivalAmbientNear);
+DEFINE_STAT(STAT_SurvivalAmbientMid);
+DEFINE_STAT(STAT_SurvivalAmbientDormant);
+DEFINE_STAT(STAT_SurvivalAmbientCulled);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, GAM312Survival, "GAM312Survival" );
@@ -3,4 +3,53 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogGAM312Survival, Log, All);
+
+/* Insights channel for the module's gameplay scopes, enable with -trace=cpu,GAM312Survival */
+UE_TRACE_CHANNEL_EXTERN(GAM312SurvivalChannel, GAM312SURVIVAL_API);
+
+// Stat group shown with "stat GAM312Survival"
+DECLARE_STATS_GROUP(TEXT("GAM312Survival"), STATGROUP_GAM312Survival, STATCAT_Advanced);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interaction"), STAT_SurvivalInteraction, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interactable Query"), STAT_SurvivalInteractableQuery, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Preview"), STAT_SurvivalBuildPreview, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Survival Stats"), STAT_SurvivalStats, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Berry Regrowth"), STAT_SurvivalBerryRegrowth, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resource State"), STAT_SurvivalResourceState, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Butterfly Tick"), STAT_SurvivalButterflyTick, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Butterfly Sprites"), STAT_SurvivalButterflySprites, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Wander Scheduler"), STAT_SurvivalWanderScheduler, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Widget Refresh"), STAT_SurvivalWidgetRefresh, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ambient Significance"), STAT_SurvivalSignificance, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Structural Integrity"), STAT_SurvivalStructuralIntegrity, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resource Respawn"), STAT_SurvivalResourceRespawn, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+
+// Per frame counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Resource State Swaps"), STAT_SurvivalResourceStateSwaps, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Preview Traces"), STAT_SurvivalPreviewTraces, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Widget Refreshes"), STAT_SurvivalWidgetRefreshes, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+
+// Population counters
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Regrowing Bushes"), STAT_SurvivalRegrowingBushes, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Butterflies"), STAT_SurvivalActiveButterflies, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Survivors"), STAT_SurvivalSurvivors, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Interactables"), STAT_SurvivalInteractables, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Compacted Structures"), STAT_SurvivalCompactedStructures, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Structure Slots"), STAT_SurvivalStructureSlots, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Collapsed Structures"), STAT_SurvivalCollapsedStructures, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Respawns"), STAT_SurvivalPendingRespawns, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Ambient Near"), STAT_SurvivalAmbientNear, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Ambient Mid"), STAT_SurvivalAmbientMid, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Ambient Dormant"), STAT_SurvivalAmbientDormant, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Ambient Culled"), STAT_SurvivalAmbientCulled, STATGROUP_GAM312Survival, GAM312SURVIVAL_API);
+
+/* Times a scope for "stat GAM312Survival" and emits it as an event on the module's trace channel */
+#define SURVIVAL_SCOPE_CYCLE_COUNTER(Stat) \
+    SCOPE_CYCLE_COUNTER(Stat); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, GAM312SurvivalChannel)
@@ -0,0 +1,203 @@
+#include "AmbientSignificanceSubsystem.h"
+#include "GAM312Survival.h"
+#include "SignificanceManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+uint64 UAmbientSignificanceSubsystem::TickCounts[UAmbientSignificanceSubsystem::NumBuckets] = {};
+
+namespace AmbientSignificance
+{
+    /* Significance manager tag of ambient actors */
+    const FName Tag(TEXT("Ambient"));
+
+    float NearDistance = 1500.0f;
+    FAutoConsoleVariableRef CVarNearDistance(
+        TEXT("survival.Significance.NearDistance"),
+        NearDistance,
+        TEXT("Distance within which ambient actors tick every frame, visible or not."),
+        ECVF_Default
+    );
+
+    float MidDistance = 4000.0f;
+    FAutoConsoleVariableRef CVarMidDistance(
+        TEXT("survival.Significance.MidDistance"),
+        MidDistance,
+        TEXT("Distance within which visible ambient actors tick at the mid interval."),
+        ECVF_Default
+    );
+
+    float CullDistance = 12000.0f;
+    FAutoConsoleVariableRef CVarCullDistance(
+        TEXT("survival.Significance.CullDistance"),
+        CullDistance,
+        TEXT("Distance past which ambient actors stop ticking."),
+        ECVF_Default
+    );
+
+    float MidTickInterval = 0.25f;
+    FAutoConsoleVariableRef CVarMidTickInterval(
+        TEXT("survival.Significance.MidTickInterval"),
+        MidTickInterval,
+        TEXT("Tick interval in seconds of mid range ambient actors."),
+        ECVF_Default
+    );
+
+    float DormantTickInterval = 1.0f;
+    FAutoConsoleVariableRef CVarDormantTickInterval(
+        TEXT("survival.Significance.DormantTickInterval"),
+        DormantTickInterval,
+        TEXT("Tick interval in seconds of visible ambient actors between the mid and cull distances."),
+        ECVF_Default
+    );
+
+    float UpdateInterval = 0.1f;
+    FAutoConsoleVariableRef CVarUpdateInterval(
+        TEXT("survival.Significance.UpdateInterval"),
+        UpdateInterval,
+        TEXT("Seconds between significance updates."),
+        ECVF_Default
+    );
+
+    /* Converts a significance score back to its bucket */
+    EAmbientSignificance ToBucket(float Significance)
+    {
+        const int32 Score = FMath::Clamp(FMath::RoundToInt(Significance), 0, UAmbientSignificanceSubsystem::NumBuckets - 1);
+        return static_cast<EAmbientSignificance>(UAmbientSignificanceSubsystem::NumBuckets - 1 - Score);
+    }
+
+    /* Converts a bucket to a significance score, higher is more significant */
+    float ToScore(EAmbientSignificance Significance)
+    {
+        return static_cast<float>(UAmbientSignificanceSubsystem::NumBuckets - 1 - static_cast<int32>(Significance));
+    }
+}
+
+bool UAmbientSignificanceSubsystem::Register(AActor* Actor)
+{
+    IAmbientSignificance* Ambient = Cast<IAmbientSignificance>(Actor);
+    USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+    if (!Ambient || !SignificanceManager || States.Contains(Actor)) return false;
+
+    FAmbientSignificanceState& State = States.Add(Actor);
+    State.Ambient = Ambient;
+    ++BucketCounts[static_cast<int32>(State.Significance)];
+
+    SignificanceManager->RegisterObject(
+        Actor,
+        AmbientSignificance::Tag,
+        [](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint)
+        {
+            return CalculateSignificance(CastChecked<AActor>(Info->GetObject()), Viewpoint);
+        },
+        USignificanceManager::EPostSignificanceType::Sequential,
+        [this](USignificanceManager::FManagedObjectInfo* Info, float OldSignificance, float Significance, bool bFinal)
+        {
+            ApplySignificance(CastChecked<AActor>(Info->GetObject()), AmbientSignificance::ToBucket(Significance));
+        }
+    );
+    return true;
+}
+
+void UAmbientSignificanceSubsystem::Unregister(AActor* Actor)
+{
+    FAmbientSignificanceState State;
+    if (!States.RemoveAndCopyValue(Actor, State)) return;
+
+    --BucketCounts[static_cast<int32>(State.Significance)];
+
+    if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+    {
+        SignificanceManager->UnregisterObject(Actor);
+    }
+}
+
+float UAmbientSignificanceSubsystem::CalculateSignificance(const AActor* Actor, const FTransform& Viewpoint)
+{
+    const float Distance = FVector::Dist(Actor->GetActorLocation(), Viewpoint.GetLocation());
+
+    // Close actors keep full rate even off screen, they can swing into view at any moment
+    if (Distance <= AmbientSignificance::NearDistance)
+    {
+        return AmbientSignificance::ToScore(EAmbientSignificance::Near);
+    }
+    const IAmbientSignificance* Ambient = Cast<IAmbientSignificance>(Actor);
+    if (Distance > AmbientSignificance::CullDistance || !Ambient || !Ambient->WasRecentlyVisible(Viewpoint, 0.5f))
+    {
+        return AmbientSignificance::ToScore(EAmbientSignificance::Culled);
+    }
+    return AmbientSignificance::ToScore(Distance <= AmbientSignificance::MidDistance
+        ? EAmbientSignificance::Mid
+        : EAmbientSignificance::Dormant);
+}
+
+void UAmbientSignificanceSubsystem::ApplySignificance(AActor* Actor, EAmbientSignificance NewSignificance)
+{
+    FAmbientSignificanceState* State = States.Find(Actor);
+    if (!State || State->Significance == NewSignificance) return;
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    float SuspendedSeconds = 0.0f;
+
+    switch (NewSignificance)
+    {
+    case EAmbientSignificance::Near:    Actor->SetActorTickInterval(0.0f); break;
+    case EAmbientSignificance::Mid:     Actor->SetActorTickInterval(AmbientSignificance::MidTickInterval); break;
+    case EAmbientSignificance::Dormant: Actor->SetActorTickInterval(AmbientSignificance::DormantTickInterval); break;
+    case EAmbientSignificance::Culled:  State->SuspendTime = Now; break;
+    }
+
+    // Hand the time spent culled back to the actor so it can catch up
+    if (State->Significance == EAmbientSignificance::Culled)
+    {
+        SuspendedSeconds = static_cast<float>(Now - State->SuspendTime);
+    }
+    Actor->SetActorTickEnabled(NewSignificance != EAmbientSignificance::Culled);
+
+    --BucketCounts[static_cast<int32>(State->Significance)];
+    ++BucketCounts[static_cast<int32>(NewSignificance)];
+    State->Significance = NewSignificance;
+
+    State->Ambient->OnSignificanceChanged(NewSignificance, SuspendedSeconds);
+}
+
+void UAmbientSignificanceSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    TimeSinceUpdate += DeltaTime;
+    if (TimeSinceUpdate < AmbientSignificance::UpdateInterval) return;
+    TimeSinceUpdate = 0.0f;
+
+    USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+    if (!SignificanceManager) return;
+
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalSignificance);
+
+    // Every local or remote player counts as a viewer
+    Viewpoints.Reset();
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        if (const APlayerController* PlayerController = It->Get())
+        {
+            FVector Location;
+            FRotator Rotation;
+            PlayerController->GetPlayerViewPoint(Location, Rotation);
+            Viewpoints.Emplace(Rotation, Location);
+        }
+    }
+    if (Viewpoints.Num() == 0) return;
+
+    SignificanceManager->Update(Viewpoints);
+
+    SET_DWORD_STAT(STAT_SurvivalAmbientNear, BucketCounts[static_cast<int32>(EAmbientSignificance::Near)]);
+    SET_DWORD_STAT(STAT_SurvivalAmbientMid, BucketCounts[static_cast<int32>(EAmbientSignificance::Mid)]);
+    SET_DWORD_STAT(STAT_SurvivalAmbientDormant, BucketCounts[static_cast<int32>(EAmbientSignificance::Dormant)]);
+    SET_DWORD_STAT(STAT_SurvivalAmbientCulled, BucketCounts[static_cast<int32>(EAmbientSignificance::Culled)]);
+}
+
+TStatId UAmbientSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAmbientSignificanceSubsystem, STATGROUP_Tickables);
+}
@@ -1,9 +1,12 @@
 #include "BerryBush.h"
+#include "BerryRegrowthSubsystem.h"
+#include "InteractableIndexSubsystem.h"
+#include "SurvivalDebugOverlay.h"
 
 ABerryBush::ABerryBush()
 {
-    // Enable tick for regrowth mechanics
-    PrimaryActorTick.bCanEverTick = true;
+    // Regrowth is batched by UBerryRegrowthSubsystem, so the bush never ticks
+    PrimaryActorTick.bCanEverTick = false;
 
     // Initialize and setup the bush base mesh
     BushMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("BushMesh"));
@@ -18,8 +21,20 @@ void ABerryBush::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Draw the berries through the shared instanced mesh, without a dynamic material
+    UBerryInstanceSubsystem* InstanceSubsystem = GetWorld()->GetSubsystem<UBerryInstanceSubsystem>();
+    if (bUseInstancedBerries && InstanceSubsystem && BerryMesh && BerryMesh->GetStaticMesh())
+    {
+        BerryInstance = InstanceSubsystem->AddInstance(
+            BerryMesh->GetStaticMesh(),
+            BerryMesh->GetMaterial(0),
+            GetBerryInstanceTransform(RegrowthProgress),
+            RegrowthProgress
+        );
+        BerryMesh->SetVisibility(false);
+    }
     // Setup dynamic material instance for berry growth effects
-    if (BerryMesh)
+    else if (BerryMesh)
     {
         // Retrieve the base material from the berry mesh
         UMaterialInterface* Material = BerryMesh->GetMaterial(0);
@@ -35,44 +50,207 @@ void ABerryBush::BeginPlay()
             }
         }
     }
+
+    // Make the bush discoverable by interaction queries
+    if (UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>())
+    {
+        InteractableHandle = InteractableIndex->RegisterActor(this);
+    }
+
+    // Bushes placed as already collected start regrowing right away
+    if (bIsCollected)
+    {
+        CollectTime = GetWorld()->GetTimeSeconds();
+        ApplyRegrowthProgress(0.0f);
+        StartRegrowth();
+    }
 }
 
-void ABerryBush::Tick(float DeltaTime)
+void ABerryBush::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
+    Super::EndPlay(EndPlayReason);
 
-    // Handle berry regrowth when collected
-    if (bIsCollected)
+    // Make sure the subsystem never holds on to a bush that left play
+    if (UBerryRegrowthSubsystem* RegrowthSubsystem = GetWorld()->GetSubsystem<UBerryRegrowthSubsystem>())
+    {
+        RegrowthSubsystem->CancelRegrowth(this);
+    }
+
+    if (UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>())
+    {
+        InteractableIndex->Unregister(InteractableHandle);
+    }
+
+    // Release the shared berry instance
+    if (UBerryInstanceSubsystem* InstanceSubsystem = GetWorld()->GetSubsystem<UBerryInstanceSubsystem>())
+    {
+        InstanceSubsystem->RemoveInstance(BerryInstance);
+    }
+}
+
+FTransform ABerryBush::GetBerryInstanceTransform(float Growth) const
+{
+    // Same transform the berry component would get with its relative scale set to the growth value
+    const FTransform RelativeTransform(BerryMesh->GetRelativeRotation(), BerryMesh->GetRelativeLocation(), FVector(Growth));
+    return RelativeTransform * BushMesh->GetComponentTransform();
+}
+
+void ABerryBush::StartRegrowth()
+{
+    if (RegrowthMode == EBerryRegrowthMode::Lazy)
+    {
+        // One looping timer per visual step; with no steps it only fires at completion
+        const float StepInterval = RegrowthTime / FMath::Max(VisualSteps, 1);
+        if (StepInterval > 0.0f)
+        {
+            GetWorldTimerManager().SetTimer(
+                RegrowthTimerHandle,
+                this,
+                &ABerryBush::OnRegrowthTimer,
+                StepInterval,
+                true // Loop until fully regrown
+            );
+        }
+        else
+        {
+            ApplyRegrowthProgress(1.0f);
+        }
+    }
+    else if (UBerryRegrowthSubsystem* RegrowthSubsystem = GetWorld()->GetSubsystem<UBerryRegrowthSubsystem>())
+    {
+        // Hand the bush over to the batched regrowth manager
+        RegrowthSubsystem->StartRegrowth(this, RegrowthTime, CollectTime);
+    }
+}
+
+float ABerryBush::ComputeRegrowthProgress() const
+{
+    if (RegrowthTime <= 0.0f) return 1.0f;
+
+    const double Elapsed = GetWorld()->GetTimeSeconds() - CollectTime;
+    const float Progress = static_cast<float>(Elapsed / RegrowthTime);
+
+    // Absorb timer rounding so the last step always completes the regrowth
+    return (Progress >= 1.0f - KINDA_SMALL_NUMBER) ? 1.0f : FMath::Clamp(Progress, 0.0f, 1.0f);
+}
+
+void ABerryBush::OnRegrowthTimer()
+{
+    // Counted with the batched regrowth, so both modes can be compared
+    SURVIVAL_DEBUG_TIMER(BerryRegrowth);
+
+    RefreshRegrowth();
+
+    if (!bIsCollected)
     {
-        // Progress the regrowth based on time
-        RegrowthProgress += DeltaTime / RegrowthTime;
+        GetWorldTimerManager().ClearTimer(RegrowthTimerHandle);
+    }
+}
 
-        // Cap regrowth at 100% and mark as available
-        if (RegrowthProgress >= 1.0f)
+void ABerryBush::RefreshRegrowth()
+{
+    if (bIsCollected && RegrowthMode == EBerryRegrowthMode::Lazy)
+    {
+        ApplyRegrowthProgress(ComputeRegrowthProgress());
+    }
+}
+
+float ABerryBush::GetRegrowthProgress() const
+{
+    return (bIsCollected && RegrowthMode == EBerryRegrowthMode::Lazy) ? ComputeRegrowthProgress() : RegrowthProgress;
+}
+
+void ABerryBush::SetRegrowthMode(EBerryRegrowthMode NewMode)
+{
+    if (RegrowthMode == NewMode) return;
+
+    // Bring the regrowth up to date and hand it over from the old mode to the new one
+    RefreshRegrowth();
+    if (bIsCollected)
+    {
+        GetWorldTimerManager().ClearTimer(RegrowthTimerHandle);
+        if (UBerryRegrowthSubsystem* RegrowthSubsystem = GetWorld()->GetSubsystem<UBerryRegrowthSubsystem>())
         {
-            RegrowthProgress = 1.0f;
-            bIsCollected = false;
+            RegrowthSubsystem->CancelRegrowth(this);
         }
+    }
 
-        // Update visual representation
-        // Scale the berry mesh based on growth progress
-        FVector NewScale = FVector(RegrowthProgress);
-        BerryMesh->SetRelativeScale3D(NewScale);
+    RegrowthMode = NewMode;
+    if (bIsCollected)
+    {
+        StartRegrowth();
+    }
+}
 
-        // Update material effects if available
-        if (BerryMaterialInstance)
+void ABerryBush::ApplyRegrowthProgress(float Progress)
+{
+    // Cap regrowth at 100% and mark as available
+    RegrowthProgress = FMath::Clamp(Progress, 0.0f, 1.0f);
+    if (RegrowthProgress >= 1.0f)
+    {
+        bIsCollected = false;
+    }
+
+    // Only push visuals when the displayed growth step changes
+    const float VisualProgress = (VisualSteps > 0)
+        ? FMath::FloorToFloat(RegrowthProgress * VisualSteps) / VisualSteps
+        : RegrowthProgress;
+
+    if (VisualProgress == DisplayedProgress) return;
+    DisplayedProgress = VisualProgress;
+
+    // Instanced berries carry their growth in per-instance custom data
+    if (BerryInstance.IsValid())
+    {
+        if (UBerryInstanceSubsystem* InstanceSubsystem = GetWorld()->GetSubsystem<UBerryInstanceSubsystem>())
         {
-            BerryMaterialInstance->SetScalarParameterValue(GrowthParameterName, RegrowthProgress);
+            InstanceSubsystem->UpdateInstance(BerryInstance, GetBerryInstanceTransform(DisplayedProgress), DisplayedProgress);
         }
+        return;
+    }
+
+    // Update visual representation
+    // Scale the berry mesh based on growth progress
+    FVector NewScale = FVector(DisplayedProgress);
+    BerryMesh->SetRelativeScale3D(NewScale);
+
+    // Update material effects if available
+    if (BerryMaterialInstance)
+    {
+        BerryMaterialInstance->SetScalarParameterValue(GrowthParameterName, DisplayedProgress);
     }
 }
 
 void ABerryBush::CollectBerry()
 {
+    // Bring lazy regrowth up to date before checking availability
+    RefreshRegrowth();
+
     // Only allow collection if berries are available
     if (!bIsCollected)
     {
         bIsCollected = true;
-        RegrowthProgress = 0.0f;
+        CollectTime = GetWorld()->GetTimeSeconds();
+        ApplyRegrowthProgress(0.0f);
+        StartRegrowth();
+    }
+}
+
+FInteractionResult ABerryBush::GetInteraction(int32 Item) const
+{
+    FInteractionResult Result;
+    Result.ResourceType = EResourceType::Berry;
+    Result.Amount = bIsCollected ? 0 : BerriesPerHarvest;
+    Result.StaminaCost = HarvestStaminaCost;
+    return Result;
+}
+
+FInteractionResult ABerryBush::Interact(AActor* Instigator, int32 Item)
+{
+    FInteractionResult Result = GetInteraction(Item);
+    if (Result.IsValid())
+    {
+        CollectBerry();
     }
+    return Result;
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "BerryInstanceSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+FBerryInstanceHandle UBerryInstanceSubsystem::AddInstance(UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& Transform, float Growth)
+{
+    FBerryInstanceHandle Handle;
+    if (!Mesh) return Handle;
+
+    FBerryInstanceBatch& Batch = FindOrAddBatch(Mesh, Material);
+    Handle.Mesh = Mesh;
+    Handle.Material = Material;
+
+    // Reuse a released slot before growing the instance buffer
+    if (Batch.FreeInstances.Num() > 0)
+    {
+        Handle.InstanceIndex = Batch.FreeInstances.Pop(EAllowShrinking::No);
+        Batch.Component->UpdateInstanceTransform(Handle.InstanceIndex, Transform, true, false);
+    }
+    else
+    {
+        Handle.InstanceIndex = Batch.Component->AddInstance(Transform, true);
+    }
+
+    Batch.Component->SetCustomDataValue(Handle.InstanceIndex, GrowthCustomDataIndex, Growth, true);
+    return Handle;
+}
+
+void UBerryInstanceSubsystem::UpdateInstance(const FBerryInstanceHandle& Handle, const FTransform& Transform, float Growth)
+{
+    if (!Handle.IsValid()) return;
+
+    FBerryInstanceBatch* Batch = FindBatch(Handle.Mesh, Handle.Material);
+    if (Batch && IsValid(Batch->Component))
+    {
+        Batch->Component->UpdateInstanceTransform(Handle.InstanceIndex, Transform, true, false);
+        Batch->Component->SetCustomDataValue(Handle.InstanceIndex, GrowthCustomDataIndex, Growth, true);
+    }
+}
+
+void UBerryInstanceSubsystem::RemoveInstance(FBerryInstanceHandle& Handle)
+{
+    if (!Handle.IsValid()) return;
+
+    // The owner may already be gone while the world is tearing down
+    FBerryInstanceBatch* Batch = FindBatch(Handle.Mesh, Handle.Material);
+    if (Batch && IsValid(Batch->Component))
+    {
+        // Collapse the instance instead of removing it so other handles keep their indices
+        FTransform Hidden;
+        Batch->Component->GetInstanceTransform(Handle.InstanceIndex, Hidden, true);
+        Hidden.SetScale3D(FVector::ZeroVector);
+        Batch->Component->UpdateInstanceTransform(Handle.InstanceIndex, Hidden, true, true);
+        Batch->FreeInstances.Add(Handle.InstanceIndex);
+    }
+
+    Handle = FBerryInstanceHandle();
+}
+
+int32 UBerryInstanceSubsystem::GetInstanceCount(UStaticMesh* Mesh, UMaterialInterface* Material) const
+{
+    const FBerryInstanceBatch* Batch = FindBatch(Mesh, Material);
+    return Batch ? Batch->Component->GetInstanceCount() - Batch->FreeInstances.Num() : 0;
+}
+
+float UBerryInstanceSubsystem::GetInstanceGrowth(const FBerryInstanceHandle& Handle) const
+{
+    const FBerryInstanceBatch* Batch = Handle.IsValid() ? FindBatch(Handle.Mesh, Handle.Material) : nullptr;
+    if (!Batch) return 0.0f;
+
+    const UInstancedStaticMeshComponent* Component = Batch->Component;
+    const int32 DataIndex = Handle.InstanceIndex * Component->NumCustomDataFloats + GrowthCustomDataIndex;
+    return Component->PerInstanceSMCustomData.IsValidIndex(DataIndex) ? Component->PerInstanceSMCustomData[DataIndex] : 0.0f;
+}
+
+UInstancedStaticMeshComponent* UBerryInstanceSubsystem::GetInstancedComponent(UStaticMesh* Mesh, UMaterialInterface* Material) const
+{
+    const FBerryInstanceBatch* Batch = FindBatch(Mesh, Material);
+    return Batch ? Batch->Component.Get() : nullptr;
+}
+
+const FBerryInstanceBatch* UBerryInstanceSubsystem::FindBatch(UStaticMesh* Mesh, UMaterialInterface* Material) const
+{
+    return Batches.Find(FBerryInstanceBatchKey(Mesh, Material));
+}
+
+FBerryInstanceBatch* UBerryInstanceSubsystem::FindBatch(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+    return Batches.Find(FBerryInstanceBatchKey(Mesh, Material));
+}
+
+FBerryInstanceBatch& UBerryInstanceSubsystem::FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+    if (FBerryInstanceBatch* Existing = FindBatch(Mesh, Material))
+    {
+        return *Existing;
+    }
+
+    // Spawn the owner lazily so worlds without instanced bushes pay nothing
+    if (!InstanceOwner)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        InstanceOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+
+        USceneComponent* Root = NewObject<USceneComponent>(InstanceOwner, TEXT("Root"));
+        InstanceOwner->SetRootComponent(Root);
+        Root->RegisterComponent();
+    }
+
+    // Setup the shared instanced component for this mesh and material
+    UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(InstanceOwner);
+    Component->SetStaticMesh(Mesh);
+    Component->SetMaterial(0, Material);
+    Component->SetNumCustomDataFloats(1);
+    Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Component->SetupAttachment(InstanceOwner->GetRootComponent());
+    Component->RegisterComponent();
+    InstanceOwner->AddInstanceComponent(Component);
+
+    FBerryInstanceBatch& Batch = Batches.Add(FBerryInstanceBatchKey(Mesh, Material));
+    Batch.Component = Component;
+    return Batch;
+}
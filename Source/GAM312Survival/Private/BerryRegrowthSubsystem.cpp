@@ -0,0 +1,77 @@
+#include "BerryRegrowthSubsystem.h"
+#include "BerryBush.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
+
+void UBerryRegrowthSubsystem::StartRegrowth(ABerryBush* Bush, float RegrowthTime, double CollectTime)
+{
+    if (!Bush) return;
+
+    // Restart the entry if the bush is already tracked
+    CancelRegrowth(Bush);
+
+    EntryIndices.Add(Bush, Entries.Num());
+    FBerryRegrowthEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.CollectTime = CollectTime;
+    Entry.RegrowthTime = RegrowthTime;
+    Entry.Bush = Bush;
+    INC_DWORD_STAT(STAT_SurvivalRegrowingBushes);
+}
+
+void UBerryRegrowthSubsystem::CancelRegrowth(ABerryBush* Bush)
+{
+    if (const int32* Index = EntryIndices.Find(Bush))
+    {
+        RemoveEntry(*Index);
+    }
+}
+
+void UBerryRegrowthSubsystem::RemoveEntry(int32 Index)
+{
+    EntryIndices.Remove(Entries[Index].Bush);
+
+    // The last entry takes over the freed index
+    const int32 LastIndex = Entries.Num() - 1;
+    if (Index != LastIndex)
+    {
+        EntryIndices[Entries[LastIndex].Bush] = Index;
+    }
+    Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    DEC_DWORD_STAT(STAT_SurvivalRegrowingBushes);
+}
+
+void UBerryRegrowthSubsystem::Tick(float DeltaTime)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalBerryRegrowth);
+    SURVIVAL_DEBUG_TIMER(BerryRegrowth);
+
+    Super::Tick(DeltaTime);
+
+    if (Clock.Advance(DeltaTime) == 0) return;
+
+    // Evaluate at the last simulated step, so fixed rate runs see the same progress values
+    const double Now = GetWorld()->GetTimeSeconds() - Clock.GetPendingSeconds();
+
+    // Iterate backwards so finished entries can be swapped out in place
+    for (int32 i = Entries.Num() - 1; i >= 0; --i)
+    {
+        const FBerryRegrowthEntry& Entry = Entries[i];
+
+        // Progress is derived from the collect time, so it never drifts with frame rate
+        const float Progress = (Entry.RegrowthTime > 0.0f)
+            ? FMath::Min(static_cast<float>((Now - Entry.CollectTime) / Entry.RegrowthTime), 1.0f)
+            : 1.0f;
+
+        Entry.Bush->ApplyRegrowthProgress(Progress);
+
+        if (Progress >= 1.0f)
+        {
+            RemoveEntry(i);
+        }
+    }
+}
+
+TStatId UBerryRegrowthSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBerryRegrowthSubsystem, STATGROUP_Tickables);
+}
@@ -1,6 +1,8 @@
 #include "BuildableBase.h"
-#include "UObject/ConstructorHelpers.h"
 #include "Materials/MaterialInterface.h"
+#include "BuildableCatalogSubsystem.h"
+#include "StructureCompactionSubsystem.h"
+#include "StructureGridSubsystem.h"
 
 ABuildableBase::ABuildableBase()
 {
@@ -20,6 +22,36 @@ void ABuildableBase::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Buildables spawned before the catalog finished loading pick it up once it has
+    UBuildableCatalogSubsystem* Catalog = GetGameInstance()->GetSubsystem<UBuildableCatalogSubsystem>();
+    if (Catalog && !Catalog->IsLoaded())
+    {
+        Catalog->OnLoaded.AddUObject(this, &ABuildableBase::ApplyCatalog);
+        return;
+    }
+
+    ApplyCatalog();
+}
+
+void ABuildableBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Level unloads and the end of play tear the whole grid down, only destroyed parts can make others collapse
+    if (EndPlayReason == EEndPlayReason::Destroyed)
+    {
+        VacateGridSlot();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ABuildableBase::ApplyCatalog()
+{
+    UBuildableCatalogSubsystem* Catalog = GetGameInstance()->GetSubsystem<UBuildableCatalogSubsystem>();
+    if (!ScaleCurve && Catalog)
+    {
+        ScaleCurve = Catalog->GetScaleCurve();
+    }
+
     // Configure timeline if curve is available
     if (ScaleCurve)
     {
@@ -33,7 +65,7 @@ void ABuildableBase::BeginPlay()
         ScaleTimeline->SetTimelineFinishedFunc(TimelineFinished);
     }
 
-    // Load appropriate mesh based on initial settings
+    // Apply appropriate mesh based on initial settings
     UpdateMesh();
 }
 
@@ -62,39 +94,85 @@ FString ABuildableBase::GetMaterialTypeString() const
 
 void ABuildableBase::UpdateMesh()
 {
-    // Construct mesh path based on current material and type
-    FString MeshPath;
-    const FString TypeString = GetBuildableTypeString().ToLower();
-    const FString MaterialString = GetMaterialTypeString().ToLower();
-
-    // Format: "/Game/Assets/Models/Building/[Material]_[Type]"
-    // Example: "/Game/Assets/Models/Building/wooden_wall"
-    MeshPath = FString::Printf(TEXT("/Game/Assets/Models/Building/%s_%s"), *MaterialString, *TypeString);
-
-    // Attempt to load and apply mesh
-    if (UStaticMesh* LoadedMesh = LoadObject<UStaticMesh>(nullptr, *MeshPath))
+    // Meshes are preloaded by the catalog, so this is only a lookup
+    const UBuildableCatalogSubsystem* Catalog = GetGameInstance()->GetSubsystem<UBuildableCatalogSubsystem>();
+    if (UStaticMesh* CatalogMesh = Catalog ? Catalog->FindMesh(MaterialType, BuildableType) : nullptr)
     {
-        BuildableMesh->SetStaticMesh(LoadedMesh);
+        BuildableMesh->SetStaticMesh(CatalogMesh);
     }
 }
 
 bool ABuildableBase::IsValidPlacement(FHitResult& OutHit) const
 {
-    // Base implementation always returns valid
-    // Derived classes should override with specific checks:
-    // - Ground proximity
-    // - Collision detection
-    // - Snapping to grid
-    return true;
+    // Without snapping there is no socket to check, so anywhere goes
+    const UStructureGridSubsystem* StructureGrid = GetWorld()->GetSubsystem<UStructureGridSubsystem>();
+    if (!UStructureGridSubsystem::IsEnabled() || !StructureGrid) return true;
+
+    // Aiming at the ground holds the part up by itself, aiming at structures needs stable neighbours to rest on
+    const bool bGrounded = StructureGrid->IsGroundHit(OutHit, GridSlot);
+    return !StructureGrid->GetGrid().IsOccupied(GridSlot) && StructureGrid->GetIntegrity().GetPlacementStability(GridSlot, bGrounded) > 0;
+}
+
+void ABuildableBase::OccupyGridSlot(const FStructureSlot& Slot, bool bGrounded)
+{
+    UStructureGridSubsystem* StructureGrid = GetWorld()->GetSubsystem<UStructureGridSubsystem>();
+    if (!StructureGrid) return;
+
+    VacateGridSlot();
+    StructureGrid->Occupy(Slot, bGrounded, this);
+    GridSlot = Slot;
+    bOccupiesGridSlot = true;
+}
+
+void ABuildableBase::VacateGridSlot()
+{
+    if (!bOccupiesGridSlot) return;
+
+    if (UStructureGridSubsystem* StructureGrid = GetWorld()->GetSubsystem<UStructureGridSubsystem>())
+    {
+        StructureGrid->Vacate(GridSlot);
+    }
+    bOccupiesGridSlot = false;
 }
 
 void ABuildableBase::PlayPlacementEffect()
 {
-    // Start scale animation if timeline is available
-    if (ScaleTimeline)
+    bPlaced = true;
+
+    // Start scale animation if timeline is available, compaction waits for it to finish
+    if (ScaleTimeline && ScaleCurve)
     {
         ScaleTimeline->PlayFromStart();
     }
+    else
+    {
+        CompactIfPlaced();
+    }
+}
+
+void ABuildableBase::StopPlacementEffect()
+{
+    if (ScaleTimeline)
+    {
+        ScaleTimeline->Stop();
+        ScaleTimeline->SetNewTime(0.0f);
+    }
+    bPlaced = false;
+}
+
+void ABuildableBase::ResetPooledState()
+{
+    StopPlacementEffect();
+    Health = MaxHealth;
+    bOccupiesGridSlot = false;
+
+    // Fall back to the class default overrides, which are usually none
+    const ABuildableBase* Defaults = GetClass()->GetDefaultObject<ABuildableBase>();
+    const TArray<TObjectPtr<UMaterialInterface>>& DefaultMaterials = Defaults->BuildableMesh->OverrideMaterials;
+    for (int32 i = 0; i < BuildableMesh->GetNumMaterials(); ++i)
+    {
+        BuildableMesh->SetMaterial(i, DefaultMaterials.IsValidIndex(i) ? DefaultMaterials[i].Get() : nullptr);
+    }
 }
 
 void ABuildableBase::UpdateScale(FVector Scale)
@@ -107,4 +185,17 @@ void ABuildableBase::OnScaleTimelineCompleted()
 {
     // Ensure final scale is reset after animation
     BuildableMesh->SetWorldScale3D(FVector(1.0f, 1.0f, 1.0f));
+
+    CompactIfPlaced();
+}
+
+void ABuildableBase::CompactIfPlaced()
+{
+    // Parts released or collapsed while animating must not be compacted from the pool
+    if (!bPlaced || !bCompactWhenPlaced || !UStructureCompactionSubsystem::IsEnabled()) return;
+
+    if (UStructureCompactionSubsystem* StructureCompaction = GetWorld()->GetSubsystem<UStructureCompactionSubsystem>())
+    {
+        StructureCompaction->Compact(this);
+    }
 }
\ No newline at end of file
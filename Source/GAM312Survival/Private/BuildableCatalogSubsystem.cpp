@@ -0,0 +1,93 @@
+#include "BuildableCatalogSubsystem.h"
+#include "BuildableCatalogSettings.h"
+#include "Curves/CurveVector.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StreamableManager.h"
+#include "GAM312Survival.h"
+
+namespace BuildableCatalog
+{
+    constexpr int32 NumBuildableTypes = static_cast<int32>(EBuildableType::Slant) + 1;
+    constexpr int32 NumMaterialTypes = static_cast<int32>(EMaterialType::Stone) + 1;
+}
+
+void UBuildableCatalogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Meshes.SetNum(BuildableCatalog::NumMaterialTypes * BuildableCatalog::NumBuildableTypes);
+
+    // Request everything in one batch, the handle keeps it loaded afterwards
+    const UBuildableCatalogSettings* Settings = GetDefault<UBuildableCatalogSettings>();
+    TArray<FSoftObjectPath> AssetPaths;
+    for (const FBuildableCatalogEntry& Entry : Settings->Meshes)
+    {
+        if (!Entry.Mesh.IsNull())
+        {
+            AssetPaths.AddUnique(Entry.Mesh.ToSoftObjectPath());
+        }
+    }
+    if (!Settings->ScaleCurve.IsNull())
+    {
+        AssetPaths.AddUnique(Settings->ScaleCurve.ToSoftObjectPath());
+    }
+
+    if (AssetPaths.Num() == 0)
+    {
+        HandleLoaded();
+        return;
+    }
+
+    LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        MoveTemp(AssetPaths),
+        FStreamableDelegate::CreateUObject(this, &UBuildableCatalogSubsystem::HandleLoaded),
+        FStreamableManager::AsyncLoadHighPriority
+    );
+}
+
+void UBuildableCatalogSubsystem::Deinitialize()
+{
+    if (LoadHandle.IsValid())
+    {
+        LoadHandle->ReleaseHandle();
+        LoadHandle.Reset();
+    }
+
+    Super::Deinitialize();
+}
+
+UStaticMesh* UBuildableCatalogSubsystem::FindMesh(EMaterialType MaterialType, EBuildableType BuildableType) const
+{
+    const int32 Index = GetMeshIndex(MaterialType, BuildableType);
+    return Meshes.IsValidIndex(Index) ? Meshes[Index].Get() : nullptr;
+}
+
+int32 UBuildableCatalogSubsystem::GetMeshIndex(EMaterialType MaterialType, EBuildableType BuildableType)
+{
+    return static_cast<int32>(MaterialType) * BuildableCatalog::NumBuildableTypes + static_cast<int32>(BuildableType);
+}
+
+void UBuildableCatalogSubsystem::HandleLoaded()
+{
+    if (bLoaded) return;
+
+    // Resolve the soft pointers once, lookups only touch the cache from here on
+    const UBuildableCatalogSettings* Settings = GetDefault<UBuildableCatalogSettings>();
+    for (const FBuildableCatalogEntry& Entry : Settings->Meshes)
+    {
+        const int32 Index = GetMeshIndex(Entry.MaterialType, Entry.BuildableType);
+        if (!Meshes.IsValidIndex(Index)) continue;
+
+        Meshes[Index] = Entry.Mesh.Get();
+        if (!Meshes[Index] && !Entry.Mesh.IsNull())
+        {
+            UE_LOG(LogGAM312Survival, Warning, TEXT("Buildable catalog mesh %s failed to load"), *Entry.Mesh.ToString());
+        }
+    }
+    ScaleCurve = Settings->ScaleCurve.Get();
+
+    bLoaded = true;
+    OnLoaded.Broadcast();
+    OnLoaded.Clear();
+}
@@ -0,0 +1,171 @@
+#include "BuildablePoolSubsystem.h"
+#include "BuildableBase.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "GAM312Survival.h"
+
+namespace BuildablePool
+{
+    bool bEnabled = true;
+    FAutoConsoleVariableRef CVarEnabled(
+        TEXT("survival.BuildablePool.Enabled"),
+        bEnabled,
+        TEXT("Recycle buildable actors instead of spawning and destroying them."),
+        ECVF_Default
+    );
+
+    int32 PrewarmCount = 8;
+    FAutoConsoleVariableRef CVarPrewarmCount(
+        TEXT("survival.BuildablePool.PrewarmCount"),
+        PrewarmCount,
+        TEXT("Inactive buildables kept ready per class while building."),
+        ECVF_Default
+    );
+
+    /* Inactive buildables wait out of the way so they never overlap anything */
+    const FVector ParkingLocation(0.0f, 0.0f, -100000.0f);
+}
+
+bool UBuildablePoolSubsystem::IsEnabled()
+{
+    return BuildablePool::bEnabled;
+}
+
+ABuildableBase* UBuildablePoolSubsystem::Acquire(TSubclassOf<ABuildableBase> Class, const FTransform& Transform, ESpawnActorCollisionHandlingMethod CollisionHandling)
+{
+    if (!Class) return nullptr;
+
+    if (!IsEnabled())
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = CollisionHandling;
+        return GetWorld()->SpawnActor<ABuildableBase>(Class, Transform, SpawnParams);
+    }
+
+    FBuildablePool& Pool = Pools.FindOrAdd(Class);
+    ABuildableBase* Buildable = nullptr;
+    while (!Buildable && Pool.Inactive.Num() > 0)
+    {
+        Buildable = Pool.Inactive.Pop(EAllowShrinking::No);
+        if (!IsValid(Buildable))
+        {
+            Buildable = nullptr;
+        }
+    }
+    if (!Buildable)
+    {
+        Buildable = SpawnInactive(Class);
+        if (!Buildable) return nullptr;
+    }
+    bNeedsPrewarm |= Pool.Inactive.Num() < Pool.PrewarmCount;
+
+    // Resolve blocking geometry the way SpawnActor would
+    FVector Location = Transform.GetLocation();
+    const FRotator Rotation = Transform.Rotator();
+    Buildable->SetActorEnableCollision(true);
+
+    bool bPlaced = true;
+    switch (CollisionHandling)
+    {
+    case ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn:
+        GetWorld()->FindTeleportSpot(Buildable, Location, Rotation);
+        break;
+    case ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding:
+        bPlaced = GetWorld()->FindTeleportSpot(Buildable, Location, Rotation);
+        break;
+    case ESpawnActorCollisionHandlingMethod::DontSpawnIfColliding:
+        bPlaced = !GetWorld()->EncroachingBlockingGeometry(Buildable, Location, Rotation);
+        break;
+    default:
+        break;
+    }
+
+    if (!bPlaced)
+    {
+        Deactivate(Buildable);
+        Pool.Inactive.Add(Buildable);
+        return nullptr;
+    }
+
+    Buildable->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+    Buildable->SetActorScale3D(Transform.GetScale3D());
+    Buildable->ResetPooledState();
+    Buildable->SetActorHiddenInGame(false);
+    return Buildable;
+}
+
+void UBuildablePoolSubsystem::Release(ABuildableBase* Buildable)
+{
+    if (!IsValid(Buildable)) return;
+
+    if (!IsEnabled())
+    {
+        Buildable->Destroy();
+        return;
+    }
+
+    Deactivate(Buildable);
+    Pools.FindOrAdd(Buildable->GetClass()).Inactive.Add(Buildable);
+}
+
+void UBuildablePoolSubsystem::Prewarm(TSubclassOf<ABuildableBase> Class, int32 Count)
+{
+    if (!Class || !IsEnabled()) return;
+
+    FBuildablePool& Pool = Pools.FindOrAdd(Class);
+    Pool.PrewarmCount = Count > 0 ? Count : BuildablePool::PrewarmCount;
+    bNeedsPrewarm |= Pool.Inactive.Num() < Pool.PrewarmCount;
+}
+
+int32 UBuildablePoolSubsystem::GetNumInactive(TSubclassOf<ABuildableBase> Class) const
+{
+    const FBuildablePool* Pool = Pools.Find(Class);
+    return Pool ? Pool->Inactive.Num() : 0;
+}
+
+void UBuildablePoolSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // One spawn per frame keeps pre-warming from becoming a spike of its own
+    bNeedsPrewarm = false;
+    for (TPair<TSubclassOf<ABuildableBase>, FBuildablePool>& Pair : Pools)
+    {
+        FBuildablePool& Pool = Pair.Value;
+        if (Pool.Inactive.Num() >= Pool.PrewarmCount) continue;
+
+        if (ABuildableBase* Buildable = SpawnInactive(Pair.Key))
+        {
+            Pool.Inactive.Add(Buildable);
+        }
+        bNeedsPrewarm = true;
+        break;
+    }
+}
+
+TStatId UBuildablePoolSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBuildablePoolSubsystem, STATGROUP_Tickables);
+}
+
+ABuildableBase* UBuildablePoolSubsystem::SpawnInactive(TSubclassOf<ABuildableBase> Class)
+{
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    ABuildableBase* Buildable = GetWorld()->SpawnActor<ABuildableBase>(Class, BuildablePool::ParkingLocation, FRotator::ZeroRotator, SpawnParams);
+    if (Buildable)
+    {
+        Deactivate(Buildable);
+    }
+    return Buildable;
+}
+
+void UBuildablePoolSubsystem::Deactivate(ABuildableBase* Buildable)
+{
+    // A placement animation finishing while parked would compact and release the part again
+    Buildable->StopPlacementEffect();
+    Buildable->SetActorHiddenInGame(true);
+    Buildable->SetActorEnableCollision(false);
+    Buildable->SetActorLocation(BuildablePool::ParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+}
@@ -0,0 +1,168 @@
+#include "ButterflySpriteSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "GAM312Survival.h"
+
+namespace ButterflySprites
+{
+    bool bEnabled = true;
+    FAutoConsoleVariableRef CVarEnabled(
+        TEXT("survival.Butterfly.SpriteBatch"),
+        bEnabled,
+        TEXT("Draw butterflies that have a sprite mesh through one instanced batch instead of a flipbook each. Applies to butterflies spawned afterwards."),
+        ECVF_Default
+    );
+
+    float ViewConeAngle = 60.0f;
+    FAutoConsoleVariableRef CVarViewConeAngle(
+        TEXT("survival.Butterfly.SpriteViewConeAngle"),
+        ViewConeAngle,
+        TEXT("Half angle in degrees of the view cone within which batched butterflies count as visible."),
+        ECVF_Default
+    );
+}
+
+bool UButterflySpriteSubsystem::IsEnabled()
+{
+    return ButterflySprites::bEnabled;
+}
+
+FButterflySpriteHandle UButterflySpriteSubsystem::AddInstance(UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& Transform, float Phase, float PlayRate)
+{
+    FButterflySpriteHandle Handle;
+    if (!Mesh) return Handle;
+
+    FButterflySpriteBatch& Batch = FindOrAddBatch(Mesh, Material);
+    Handle.Mesh = Mesh;
+    Handle.Material = Material;
+
+    // Reuse a released slot before growing the instance buffer
+    if (Batch.FreeInstances.Num() > 0)
+    {
+        Handle.InstanceIndex = Batch.FreeInstances.Pop(EAllowShrinking::No);
+        Batch.Transforms[Handle.InstanceIndex] = Transform;
+        Batch.bDirty = true;
+    }
+    else
+    {
+        Handle.InstanceIndex = Batch.Component->AddInstance(Transform, true);
+        Batch.Transforms.Add(Transform);
+    }
+
+    Batch.Component->SetCustomDataValue(Handle.InstanceIndex, PhaseCustomDataIndex, Phase, false);
+    Batch.Component->SetCustomDataValue(Handle.InstanceIndex, PlayRateCustomDataIndex, PlayRate, true);
+    return Handle;
+}
+
+void UButterflySpriteSubsystem::UpdateInstance(const FButterflySpriteHandle& Handle, const FTransform& Transform)
+{
+    if (!Handle.IsValid()) return;
+
+    if (FButterflySpriteBatch* Batch = FindBatch(Handle))
+    {
+        Batch->Transforms[Handle.InstanceIndex] = Transform;
+        Batch->bDirty = true;
+    }
+}
+
+void UButterflySpriteSubsystem::RemoveInstance(FButterflySpriteHandle& Handle)
+{
+    if (!Handle.IsValid()) return;
+
+    // Collapse the instance instead of removing it so other handles keep their indices
+    if (FButterflySpriteBatch* Batch = FindBatch(Handle))
+    {
+        Batch->Transforms[Handle.InstanceIndex].SetScale3D(FVector::ZeroVector);
+        Batch->FreeInstances.Add(Handle.InstanceIndex);
+        Batch->bDirty = true;
+    }
+
+    Handle = FButterflySpriteHandle();
+}
+
+int32 UButterflySpriteSubsystem::GetInstanceCount(UStaticMesh* Mesh, UMaterialInterface* Material) const
+{
+    const FButterflySpriteBatch* Batch = Batches.Find(FButterflySpriteBatchKey(Mesh, Material));
+    return Batch ? Batch->Transforms.Num() - Batch->FreeInstances.Num() : 0;
+}
+
+bool UButterflySpriteSubsystem::WasInstanceRecentlyVisible(const FButterflySpriteHandle& Handle, const FTransform& Viewpoint, float Tolerance) const
+{
+    if (!Handle.IsValid()) return false;
+
+    // The batch only tracks when any of its instances was drawn, so narrow it down to the view cone
+    const FButterflySpriteBatch* Batch = FindBatch(Handle);
+    if (!Batch || !Batch->Component || !Batch->Component->WasRecentlyRendered(Tolerance)) return false;
+
+    const FVector ToInstance = (Batch->Transforms[Handle.InstanceIndex].GetLocation() - Viewpoint.GetLocation()).GetSafeNormal();
+    return FVector::DotProduct(ToInstance, Viewpoint.GetRotation().GetForwardVector()) >= FMath::Cos(FMath::DegreesToRadians(ButterflySprites::ViewConeAngle));
+}
+
+void UButterflySpriteSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalButterflySprites);
+
+    for (TPair<FButterflySpriteBatchKey, FButterflySpriteBatch>& Pair : Batches)
+    {
+        FButterflySpriteBatch& Batch = Pair.Value;
+
+        // The owner may already be gone while the world is tearing down
+        if (!Batch.bDirty || !IsValid(Batch.Component)) continue;
+
+        Batch.Component->BatchUpdateInstancesTransforms(0, Batch.Transforms, true, true, true);
+        Batch.bDirty = false;
+    }
+}
+
+TStatId UButterflySpriteSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UButterflySpriteSubsystem, STATGROUP_Tickables);
+}
+
+const FButterflySpriteBatch* UButterflySpriteSubsystem::FindBatch(const FButterflySpriteHandle& Handle) const
+{
+    return Batches.Find(FButterflySpriteBatchKey(Handle.Mesh, Handle.Material));
+}
+
+FButterflySpriteBatch* UButterflySpriteSubsystem::FindBatch(const FButterflySpriteHandle& Handle)
+{
+    return Batches.Find(FButterflySpriteBatchKey(Handle.Mesh, Handle.Material));
+}
+
+FButterflySpriteBatch& UButterflySpriteSubsystem::FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+    const FButterflySpriteBatchKey Key(Mesh, Material);
+    if (FButterflySpriteBatch* Existing = Batches.Find(Key))
+    {
+        return *Existing;
+    }
+
+    // Spawn the owner lazily so worlds without batched butterflies pay nothing
+    if (!InstanceOwner)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        InstanceOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+
+        USceneComponent* Root = NewObject<USceneComponent>(InstanceOwner, TEXT("Root"));
+        InstanceOwner->SetRootComponent(Root);
+        Root->RegisterComponent();
+    }
+
+    // Sprites are purely visual, nothing collides with or is shadowed by them
+    UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(InstanceOwner);
+    Component->SetStaticMesh(Mesh);
+    Component->SetMaterial(0, Material);
+    Component->SetNumCustomDataFloats(NumCustomDataFloats);
+    Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Component->SetCastShadow(false);
+    Component->SetupAttachment(InstanceOwner->GetRootComponent());
+    Component->RegisterComponent();
+    InstanceOwner->AddInstanceComponent(Component);
+
+    FButterflySpriteBatch& Batch = Batches.Add(Key);
+    Batch.Component = Component;
+    return Batch;
+}
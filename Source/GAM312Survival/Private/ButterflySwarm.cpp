@@ -0,0 +1,231 @@
+#include "ButterflySwarm.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Math/VectorRegister.h"
+#include "ButterflySpriteSubsystem.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
+
+AButterflySwarm::AButterflySwarm()
+{
+    PrimaryActorTick.bCanEverTick = true;
+
+    RootComp = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
+    RootComponent = RootComp;
+
+    // Purely visual, nothing should collide with or be shadowed by the butterflies
+    Instances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("Instances"));
+    Instances->SetupAttachment(RootComponent);
+    Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Instances->SetCastShadow(false);
+    Instances->SetCanEverAffectNavigation(false);
+    Instances->NumCustomDataFloats = UButterflySpriteSubsystem::NumCustomDataFloats;
+}
+
+void AButterflySwarm::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (RandomSeed != 0)
+    {
+        Random.Initialize(RandomSeed);
+    }
+    else
+    {
+        Random.GenerateNewSeed();
+    }
+
+    SpawnButterflies();
+    INC_DWORD_STAT_BY(STAT_SurvivalActiveButterflies, NumButterflies);
+}
+
+void AButterflySwarm::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    DEC_DWORD_STAT_BY(STAT_SurvivalActiveButterflies, NumButterflies);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AButterflySwarm::SpawnButterflies()
+{
+    NumButterflies = ButterflyCount;
+
+    // Pad to whole vectors so the simulation loop needs no scalar tail
+    const int32 NumPadded = Align(NumButterflies, 4);
+    for (TArray<float>* Array : { &PositionX, &PositionY, &PositionZ, &PreviousX, &PreviousY, &PreviousZ,
+        &TargetX, &TargetY, &TargetZ, &StartX, &StartY, &StartZ, &RightX, &RightY,
+        &Phase, &InitialDistance, &WanderTimeLeft, &RenderZ })
+    {
+        Array->SetNumZeroed(NumPadded);
+    }
+
+    Transforms.SetNum(NumButterflies);
+    for (int32 i = 0; i < NumButterflies; ++i)
+    {
+        // Uniform over the spawn disc
+        const float Angle = Random.FRandRange(0.0f, 2 * PI);
+        const FVector2D Start = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * SpawnRadius * FMath::Sqrt(Random.FRand());
+        StartX[i] = PositionX[i] = PreviousX[i] = Start.X;
+        StartY[i] = PositionY[i] = PreviousY[i] = Start.Y;
+
+        // Desynchronize bobbing and retargeting across the swarm
+        Phase[i] = Random.FRandRange(0.0f, 1.0f / BobbingFrequency);
+        PickTarget(i);
+
+        Transforms[i] = FTransform(FVector(Start.X, Start.Y, 0.0f));
+    }
+
+    // Padding lanes sit on their target and never move
+    for (int32 i = NumButterflies; i < NumPadded; ++i)
+    {
+        WanderTimeLeft[i] = MAX_flt;
+    }
+
+    Instances->SetStaticMesh(ButterflyMesh);
+    Instances->ClearInstances();
+    Instances->AddInstances(Transforms, false, false);
+
+    // Same sprite animation data as the sprite batch, phase shared with bobbing
+    for (int32 i = 0; i < NumButterflies; ++i)
+    {
+        Instances->SetCustomDataValue(i, UButterflySpriteSubsystem::PhaseCustomDataIndex, Phase[i], false);
+        Instances->SetCustomDataValue(i, UButterflySpriteSubsystem::PlayRateCustomDataIndex, AnimationPlayRate, false);
+    }
+    Instances->MarkRenderStateDirty();
+}
+
+void AButterflySwarm::Tick(float DeltaTime)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalButterflyTick);
+    SURVIVAL_DEBUG_TIMER(Butterflies);
+
+    Super::Tick(DeltaTime);
+
+    if (NumButterflies == 0) return;
+
+    // Simulate whole steps, then render in between the last two
+    const int32 Steps = SimulationClock.Advance(DeltaTime);
+    for (int32 Step = 0; Step < Steps; ++Step)
+    {
+        PreviousX = PositionX;
+        PreviousY = PositionY;
+        PreviousZ = PositionZ;
+        StepSwarm(SimulationClock.GetStepSeconds());
+    }
+
+    UpdateInstances(SimulationClock.GetAlpha());
+}
+
+void AButterflySwarm::StepSwarm(float StepSeconds)
+{
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float One = VectorOneFloat();
+    const VectorRegister4Float Tiny = VectorSetFloat1(UE_SMALL_NUMBER);
+    const VectorRegister4Float Step = VectorSetFloat1(StepSeconds);
+    const VectorRegister4Float MaxMove = VectorSetFloat1(MoveSpeed * StepSeconds);
+    const VectorRegister4Float LateralOmega = VectorSetFloat1(LateralFrequency * 2.0f * PI);
+    const VectorRegister4Float Amplitude = VectorSetFloat1(LateralAmplitude);
+
+    const int32 NumPadded = PositionX.Num();
+    for (int32 i = 0; i < NumPadded; i += 4)
+    {
+        const VectorRegister4Float PX = VectorLoad(&PositionX[i]);
+        const VectorRegister4Float PY = VectorLoad(&PositionY[i]);
+        const VectorRegister4Float PZ = VectorLoad(&PositionZ[i]);
+        const VectorRegister4Float TX = VectorLoad(&TargetX[i]);
+        const VectorRegister4Float TY = VectorLoad(&TargetY[i]);
+        const VectorRegister4Float TZ = VectorLoad(&TargetZ[i]);
+
+        // Constant speed towards the target, snapping onto it once within one step
+        const VectorRegister4Float DX = VectorSubtract(TX, PX);
+        const VectorRegister4Float DY = VectorSubtract(TY, PY);
+        const VectorRegister4Float DZ = VectorSubtract(TZ, PZ);
+        const VectorRegister4Float DistSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+        const VectorRegister4Float MoveScale = VectorMin(VectorMultiply(MaxMove, VectorReciprocalSqrt(VectorMax(DistSq, Tiny))), One);
+
+        VectorRegister4Float NX = VectorMultiplyAdd(DX, MoveScale, PX);
+        VectorRegister4Float NY = VectorMultiplyAdd(DY, MoveScale, PY);
+        const VectorRegister4Float NZ = VectorMultiplyAdd(DZ, MoveScale, PZ);
+
+        // Lateral sway fades out as the butterfly closes in on its target
+        const VectorRegister4Float RX = VectorSubtract(TX, NX);
+        const VectorRegister4Float RY = VectorSubtract(TY, NY);
+        const VectorRegister4Float Remaining = VectorSqrt(VectorMultiplyAdd(RX, RX, VectorMultiply(RY, RY)));
+        const VectorRegister4Float Initial = VectorLoad(&InitialDistance[i]);
+        const VectorRegister4Float LateralScale = VectorSelect(
+            VectorCompareGT(Initial, Zero),
+            VectorMin(VectorMax(VectorDivide(Remaining, VectorMax(Initial, Tiny)), Zero), One),
+            Zero);
+
+        const VectorRegister4Float NewPhase = VectorAdd(VectorLoad(&Phase[i]), Step);
+        const VectorRegister4Float Lateral = VectorMultiply(VectorMultiply(VectorSin(VectorMultiply(NewPhase, LateralOmega)), Amplitude), LateralScale);
+
+        NX = VectorMultiplyAdd(VectorLoad(&RightX[i]), Lateral, NX);
+        NY = VectorMultiplyAdd(VectorLoad(&RightY[i]), Lateral, NY);
+
+        VectorStore(NX, &PositionX[i]);
+        VectorStore(NY, &PositionY[i]);
+        VectorStore(NZ, &PositionZ[i]);
+        VectorStore(NewPhase, &Phase[i]);
+        VectorStore(VectorSubtract(VectorLoad(&WanderTimeLeft[i]), Step), &WanderTimeLeft[i]);
+    }
+
+    // Only a few butterflies retarget on any step
+    for (int32 i = 0; i < NumButterflies; ++i)
+    {
+        if (WanderTimeLeft[i] <= 0.0f)
+        {
+            PickTarget(i);
+        }
+    }
+}
+
+void AButterflySwarm::PickTarget(int32 Index)
+{
+    // Random angle, radius, and vertical variation for movement
+    const float Angle = Random.FRandRange(0.0f, 2 * PI);
+    const float Radius = Random.FRandRange(0.0f, WanderRadius);
+
+    TargetX[Index] = StartX[Index] + FMath::Cos(Angle) * Radius;
+    TargetY[Index] = StartY[Index] + FMath::Sin(Angle) * Radius;
+    TargetZ[Index] = StartZ[Index] + Random.FRandRange(-ZVariationRange, ZVariationRange);
+
+    // Right of the horizontal direction from the start to the target
+    const FVector2D ToTarget = FVector2D(TargetX[Index] - StartX[Index], TargetY[Index] - StartY[Index]).GetSafeNormal();
+    RightX[Index] = ToTarget.Y;
+    RightY[Index] = -ToTarget.X;
+
+    InitialDistance[Index] = FVector2D::Distance(
+        FVector2D(PositionX[Index], PositionY[Index]),
+        FVector2D(TargetX[Index], TargetY[Index]));
+
+    WanderTimeLeft[Index] = Random.FRandRange(WanderInterval * 0.5f, WanderInterval * 1.5f);
+}
+
+void AButterflySwarm::UpdateInstances(float Alpha)
+{
+    // Bobbing is visual only, evaluated at the interpolated time
+    const float StepSeconds = SimulationClock.GetStepSeconds();
+    const VectorRegister4Float VisualOffset = VectorSetFloat1((1.0f - Alpha) * StepSeconds);
+    const VectorRegister4Float BobOmega = VectorSetFloat1(BobbingFrequency * 2.0f * PI);
+    const VectorRegister4Float BobAmplitude = VectorSetFloat1(BobbingAmplitude);
+    const VectorRegister4Float AlphaVector = VectorSetFloat1(Alpha);
+
+    const int32 NumPadded = PositionZ.Num();
+    for (int32 i = 0; i < NumPadded; i += 4)
+    {
+        const VectorRegister4Float Previous = VectorLoad(&PreviousZ[i]);
+        const VectorRegister4Float Z = VectorMultiplyAdd(VectorSubtract(VectorLoad(&PositionZ[i]), Previous), AlphaVector, Previous);
+        const VectorRegister4Float VisualTime = VectorSubtract(VectorLoad(&Phase[i]), VisualOffset);
+        VectorStore(VectorMultiplyAdd(VectorSin(VectorMultiply(VisualTime, BobOmega)), BobAmplitude, Z), &RenderZ[i]);
+    }
+
+    for (int32 i = 0; i < NumButterflies; ++i)
+    {
+        Transforms[i].SetTranslation(FVector(
+            FMath::Lerp(PreviousX[i], PositionX[i], Alpha),
+            FMath::Lerp(PreviousY[i], PositionY[i], Alpha),
+            RenderZ[i]));
+    }
+
+    Instances->BatchUpdateInstancesTransforms(0, Transforms, false, true, true);
+}
@@ -1,5 +1,9 @@
 #include "ButterflyWander.h"
 #include "Math/UnrealMathUtility.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
+#include "AmbientSignificanceSubsystem.h"
+#include "WanderSchedulerSubsystem.h"
 
 AButterflyWander::AButterflyWander()
 {
@@ -17,31 +21,138 @@ void AButterflyWander::BeginPlay()
 {
     Super::BeginPlay();
 
+    INC_DWORD_STAT(STAT_SurvivalActiveButterflies);
+
     // Store initial spawn location
     StartingLocation = GetActorLocation();
     TargetLocation = StartingLocation;
+    SimulatedLocation = StartingLocation;
+    PreviousSimulatedLocation = StartingLocation;
 
-    // Start wander timer timer with random interval
-    GetWorldTimerManager().SetTimer(
-        WanderTimerHandle,
-        this,
-        &AButterflyWander::UpdateTargetLocation,
-        FMath::RandRange(WanderInterval * 0.5f, WanderInterval * 1.5f),
-        false
-    );
-
-    // Make sure that wandering starts immediately
+    // Make sure that wandering starts immediately, this also schedules the next retarget
     UpdateTargetLocation();
+
+    MoveToSpriteBatch();
+
+    // Throttle ticking by distance and visibility
+    if (UAmbientSignificanceSubsystem* AmbientSignificance = GetWorld()->GetSubsystem<UAmbientSignificanceSubsystem>())
+    {
+        AmbientSignificance->Register(this);
+    }
+}
+
+void AButterflyWander::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    DEC_DWORD_STAT(STAT_SurvivalActiveButterflies);
+
+    if (UButterflySpriteSubsystem* Sprites = GetWorld()->GetSubsystem<UButterflySpriteSubsystem>())
+    {
+        Sprites->RemoveInstance(SpriteHandle);
+    }
+
+    if (UAmbientSignificanceSubsystem* AmbientSignificance = GetWorld()->GetSubsystem<UAmbientSignificanceSubsystem>())
+    {
+        AmbientSignificance->Unregister(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AButterflyWander::OnSignificanceChanged(EAmbientSignificance NewSignificance, float SuspendedSeconds)
+{
+    Significance = NewSignificance;
+
+    // Culled butterflies are not seen, so their flipbook does not need to animate either
+    if (FlipbookComponent)
+    {
+        FlipbookComponent->SetComponentTickEnabled(NewSignificance != EAmbientSignificance::Culled);
+    }
+
+    // Move as far as the time spent culled allows, then resume from there without interpolating
+    if (SuspendedSeconds > 0.0f)
+    {
+        StepMovement(SuspendedSeconds);
+        PreviousSimulatedLocation = SimulatedLocation;
+        SetActorLocation(SimulatedLocation);
+    }
+}
+
+bool AButterflyWander::WasRecentlyVisible(const FTransform& Viewpoint, float Tolerance) const
+{
+    if (SpriteHandle.IsValid())
+    {
+        const UButterflySpriteSubsystem* Sprites = GetWorld()->GetSubsystem<UButterflySpriteSubsystem>();
+        return Sprites && Sprites->WasInstanceRecentlyVisible(SpriteHandle, Viewpoint, Tolerance);
+    }
+    return WasRecentlyRendered(Tolerance);
 }
 
 void AButterflyWander::Tick(float DeltaTime)
 {
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalButterflyTick);
+    SURVIVAL_DEBUG_TIMER(Butterflies);
+    UAmbientSignificanceSubsystem::CountTick(Significance);
+
     Super::Tick(DeltaTime);
 
+    // Simulate whole steps, then render in between the last two
+    const int32 Steps = SimulationClock.Advance(DeltaTime);
+    const float StepSeconds = SimulationClock.GetStepSeconds();
+    for (int32 Step = 0; Step < Steps; ++Step)
+    {
+        PreviousSimulatedLocation = SimulatedLocation;
+        StepMovement(StepSeconds);
+    }
+
+    const float Alpha = SimulationClock.GetAlpha();
+    SetActorLocation(FMath::Lerp(PreviousSimulatedLocation, SimulatedLocation, Alpha));
+
+    // Update bobbing effect
+    const float VisualTime = TotalTime - (1.0f - Alpha) * StepSeconds;
+    float ZOffset = FMath::Sin(VisualTime * BobbingFrequency * 2 * PI) * BobbingAmplitude;
+    if (SpriteHandle.IsValid())
+    {
+        if (UButterflySpriteSubsystem* Sprites = GetWorld()->GetSubsystem<UButterflySpriteSubsystem>())
+        {
+            FTransform SpriteTransform = SpriteRelativeTransform;
+            SpriteTransform.AddToTranslation(FVector(0, 0, ZOffset));
+            Sprites->UpdateInstance(SpriteHandle, SpriteTransform * GetActorTransform());
+        }
+    }
+    else if (FlipbookComponent)
+    {
+        FlipbookComponent->SetRelativeLocation(FVector(0, 0, ZOffset));
+    }
+}
+
+bool AButterflyWander::MoveToSpriteBatch()
+{
+    UButterflySpriteSubsystem* Sprites = GetWorld()->GetSubsystem<UButterflySpriteSubsystem>();
+    if (!SpriteMesh || !FlipbookComponent || !Sprites || !UButterflySpriteSubsystem::IsEnabled()) return false;
+
+    // Random phase so the batch does not flap in sync
+    SpriteRelativeTransform = FlipbookComponent->GetRelativeTransform();
+    SpriteHandle = Sprites->AddInstance(
+        SpriteMesh,
+        SpriteMaterial,
+        SpriteRelativeTransform * GetActorTransform(),
+        FMath::FRandRange(0.0f, FMath::Max(FlipbookComponent->GetFlipbookLength(), 1.0f)),
+        FlipbookComponent->GetPlayRate()
+    );
+    if (!SpriteHandle.IsValid()) return false;
+
+    // The flipbook would otherwise still cost a primitive and a render proxy
+    FlipbookComponent->DestroyComponent();
+    FlipbookComponent = nullptr;
+    return true;
+}
+
+void AButterflyWander::StepMovement(float StepSeconds)
+{
     FVector NewLocation = FMath::VInterpConstantTo(
-        GetActorLocation(),
+        SimulatedLocation,
         TargetLocation,
-        DeltaTime,
+        StepSeconds,
         MoveSpeed
     );
 
@@ -52,25 +163,28 @@ void AButterflyWander::Tick(float DeltaTime)
         : 0.0f;
 
     // Increment total time
-    TotalTime += DeltaTime;
+    TotalTime += StepSeconds;
 
     // Apply scaled lateral movement
     float LateralOffset = FMath::Sin(TotalTime * LateralFrequency * 2 * PI) * LateralAmplitude * LateralScale;
     NewLocation += CurrentRightDir * LateralOffset;
 
-    SetActorLocation(NewLocation);
-
-    // Update bobbing effect
-    float ZOffset = FMath::Sin(TotalTime * BobbingFrequency * 2 * PI) * BobbingAmplitude;
-    FlipbookComponent->SetRelativeLocation(FVector(0, 0, ZOffset));
+    SimulatedLocation = NewLocation;
 }
 
 void AButterflyWander::UpdateTargetLocation()
 {
+    // Draw from the scheduler's stream when it is in charge, the global one otherwise
+    UWanderSchedulerSubsystem* Scheduler = UWanderSchedulerSubsystem::IsEnabled() ? GetWorld()->GetSubsystem<UWanderSchedulerSubsystem>() : nullptr;
+    auto RandRange = [Scheduler](float Min, float Max)
+    {
+        return Scheduler ? Scheduler->GetRandomStream().FRandRange(Min, Max) : FMath::RandRange(Min, Max);
+    };
+
     // Random angle, radius, and vertical variation for movement
-    float Angle = FMath::RandRange(0.0f, 2 * PI);
-    float Radius = FMath::RandRange(0.0f, WanderRadius);
-    float ZVariation = FMath::RandRange(-ZVariationRange, ZVariationRange);
+    float Angle = RandRange(0.0f, 2 * PI);
+    float Radius = RandRange(0.0f, WanderRadius);
+    float ZVariation = RandRange(-ZVariationRange, ZVariationRange);
 
     FVector2D CirclePoint = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius;
     TargetLocation = FVector(
@@ -85,14 +199,22 @@ void AButterflyWander::UpdateTargetLocation()
     CurrentRightDir = FVector::CrossProduct(ToTarget, FVector::UpVector).GetSafeNormal();
 
     // Store initial distance to target
-    InitialDistanceToTarget = FVector::Dist2D(GetActorLocation(), TargetLocation);
-
-    // Set next timer with random interval
-    GetWorldTimerManager().SetTimer(
-        WanderTimerHandle,
-        this,
-        &AButterflyWander::UpdateTargetLocation,
-        FMath::RandRange(WanderInterval * 0.5f, WanderInterval * 1.5f),
-        false
-    );
+    InitialDistanceToTarget = FVector::Dist2D(SimulatedLocation, TargetLocation);
+
+    // Schedule the next retarget with random interval
+    const float Interval = RandRange(WanderInterval * 0.5f, WanderInterval * 1.5f);
+    if (Scheduler)
+    {
+        Scheduler->ScheduleRetarget(this, Interval);
+    }
+    else
+    {
+        GetWorldTimerManager().SetTimer(
+            WanderTimerHandle,
+            this,
+            &AButterflyWander::UpdateTargetLocation,
+            Interval,
+            false
+        );
+    }
 }
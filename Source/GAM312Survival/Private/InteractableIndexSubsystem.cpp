@@ -0,0 +1,144 @@
+#include "InteractableIndexSubsystem.h"
+#include "Engine/World.h"
+#include "GAM312Survival.h"
+
+FIntVector UInteractableIndexSubsystem::GetCell(const FVector& Location)
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize)
+    );
+}
+
+int32 UInteractableIndexSubsystem::Register(AActor* Actor, const FVector& Location, float Radius, int32 Item)
+{
+    IInteractable* Interactable = Cast<IInteractable>(Actor);
+    if (!Interactable) return INDEX_NONE;
+
+    FInteractableEntry Entry;
+    Entry.Actor = Actor;
+    Entry.Interactable = Interactable;
+    Entry.Item = Item;
+    Entry.Location = Location;
+    Entry.Radius = Radius;
+    Entry.Cell = GetCell(Location);
+
+    const int32 Handle = Entries.Add(Entry);
+    Cells.FindOrAdd(Entry.Cell).Add(Handle);
+    INC_DWORD_STAT(STAT_SurvivalInteractables);
+    return Handle;
+}
+
+int32 UInteractableIndexSubsystem::RegisterActor(AActor* Actor)
+{
+    if (!Actor) return INDEX_NONE;
+
+    // Use the component bounds so the entry sits where the player actually looks
+    FVector Origin;
+    FVector Extent;
+    Actor->GetActorBounds(true, Origin, Extent);
+    if (Extent.IsNearlyZero())
+    {
+        Origin = Actor->GetActorLocation();
+    }
+    return Register(Actor, Origin, Extent.Size());
+}
+
+void UInteractableIndexSubsystem::Unregister(int32& Handle)
+{
+    if (!Entries.IsValidIndex(Handle))
+    {
+        Handle = INDEX_NONE;
+        return;
+    }
+
+    const FIntVector Cell = Entries[Handle].Cell;
+    if (TArray<int32>* CellEntries = Cells.Find(Cell))
+    {
+        CellEntries->RemoveSingleSwap(Handle, EAllowShrinking::No);
+        if (CellEntries->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+
+    Entries.RemoveAt(Handle);
+    Handle = INDEX_NONE;
+    DEC_DWORD_STAT(STAT_SurvivalInteractables);
+}
+
+FInteractionTarget UInteractableIndexSubsystem::FindInteractable(const FInteractableQuery& Query) const
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalInteractableQuery);
+
+    FInteractionTarget Target;
+
+    const float ConeSlope = FMath::Tan(FMath::DegreesToRadians(Query.ConeHalfAngle));
+    const FIntVector MinCell = GetCell(Query.ViewLocation - FVector(Query.Range));
+    const FIntVector MaxCell = GetCell(Query.ViewLocation + FVector(Query.Range));
+
+    const FInteractableEntry* Best = nullptr;
+    float BestDistance = TNumericLimits<float>::Max();
+
+    // Only visit the cells overlapping the interaction range
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+            {
+                const TArray<int32>* CellEntries = Cells.Find(FIntVector(X, Y, Z));
+                if (!CellEntries) continue;
+
+                for (const int32 Handle : *CellEntries)
+                {
+                    const FInteractableEntry& Entry = Entries[Handle];
+                    if (Entry.Actor.Get() == Query.IgnoredActor) continue;
+
+                    // Distance along the view direction, widened by the entry radius
+                    const FVector ToEntry = Entry.Location - Query.ViewLocation;
+                    const float Along = FVector::DotProduct(ToEntry, Query.ViewDirection);
+                    if (Along < -Entry.Radius) continue;
+
+                    const float Distance = FMath::Max(ToEntry.Size() - Entry.Radius, 0.0f);
+                    if (Distance > Query.Range || Distance >= BestDistance) continue;
+
+                    // Perpendicular offset must fit inside the cone at that distance
+                    const float Perpendicular = FMath::Sqrt(FMath::Max(ToEntry.SizeSquared() - Along * Along, 0.0f));
+                    if (Perpendicular > FMath::Max(Along, 0.0f) * ConeSlope + Entry.Radius) continue;
+
+                    // Skip collected bushes, depleted resources and the like
+                    if (!Entry.Actor.IsValid() || !Entry.Interactable->GetInteraction(Entry.Item).IsValid()) continue;
+
+                    Best = &Entry;
+                    BestDistance = Distance;
+                }
+            }
+        }
+    }
+
+    if (!Best) return Target;
+
+    AActor* BestActor = Best->Actor.Get();
+
+    // Single narrow-phase trace to make sure nothing blocks the best candidate; for actors with
+    // several items, e.g. resource fields, a different item of the same actor also counts as a blocker
+    if (Query.bTraceForOcclusion)
+    {
+        FCollisionQueryParams QueryParams;
+        QueryParams.AddIgnoredActor(Query.IgnoredActor);
+
+        FHitResult Hit;
+        if (GetWorld()->LineTraceSingleByChannel(Hit, Query.ViewLocation, Best->Location, ECC_Visibility, QueryParams)
+            && (Hit.GetActor() != BestActor || Best->Interactable->GetItemForHit(Hit) != Best->Item))
+        {
+            return Target;
+        }
+    }
+
+    Target.Actor = BestActor;
+    Target.Interactable = Best->Interactable;
+    Target.Item = Best->Item;
+    return Target;
+}
@@ -1,4 +1,9 @@
 #include "MineableResource.h"
+#include "ResourceDefinition.h"
+#include "InteractableIndexSubsystem.h"
+#include "ResourceRespawnSubsystem.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
 
 AMineableResource::AMineableResource()
 {
@@ -12,36 +17,96 @@ void AMineableResource::BeginPlay()
 {
     Super::BeginPlay();
 
-    // Reset to initial state if configured
-    if (bResetOnBeginPlay)
+    // Reset to initial state if configured, resources sharing a definition always start fresh
+    if (bResetOnBeginPlay || Definition)
     {
-        CurrentStateIndex = InitialStateIndex;
+        CurrentStateIndex = GetInitialStateIndex();
     }
 
     ValidateIndices();
     UpdateMeshState();
+
+    // Make the resource discoverable by interaction queries
+    if (UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>())
+    {
+        InteractableHandle = InteractableIndex->RegisterActor(this);
+    }
+}
+
+void AMineableResource::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Super::EndPlay(EndPlayReason);
+
+    if (UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>())
+    {
+        InteractableIndex->Unregister(InteractableHandle);
+    }
+}
+
+const TArray<FResourceState>& AMineableResource::GetResourceStates() const
+{
+    return Definition ? Definition->States : ResourceStates;
+}
+
+int32 AMineableResource::GetInitialStateIndex() const
+{
+    return Definition ? Definition->GetInitialStateIndex() : InitialStateIndex;
+}
+
+float AMineableResource::GetRespawnSeconds() const
+{
+    return Definition ? Definition->RespawnSeconds : RespawnSeconds;
+}
+
+void AMineableResource::Respawn()
+{
+    CurrentStateIndex = GetInitialStateIndex();
+    ValidateIndices();
+    UpdateMeshState();
+}
+
+int32 AMineableResource::FindStateIndex(int32 Remaining) const
+{
+    return Definition ? Definition->FindStateForAmount(Remaining) : FindStateForAmount(ResourceStates, Remaining);
+}
+
+int32 AMineableResource::GetChunkAmount(int32 StateIndex, int32 Remaining) const
+{
+    if (Definition) return Definition->GetChunkAmount(StateIndex, Remaining);
+
+    if (Remaining <= 0 || !ResourceStates.IsValidIndex(StateIndex + 1)) return 0;
+
+    // Calculate chunk size based on difference between current and next state
+    return Remaining - ResourceStates[StateIndex + 1].ResourceAmount;
 }
 
 void AMineableResource::ValidateIndices()
 {
-    if (ResourceStates.Num() > 0)
+    const TArray<FResourceState>& States = GetResourceStates();
+    if (States.Num() > 0)
     {
         // Ensure indices stay within valid range
-        CurrentStateIndex = FMath::Clamp(CurrentStateIndex, 0, ResourceStates.Num() - 1);
-        InitialStateIndex = FMath::Clamp(InitialStateIndex, 0, ResourceStates.Num() - 1);
+        CurrentStateIndex = FMath::Clamp(CurrentStateIndex, 0, States.Num() - 1);
+
+        // The legacy index is only used without a definition, so keep it intact for when the definition is cleared
+        if (!Definition)
+        {
+            InitialStateIndex = FMath::Clamp(InitialStateIndex, 0, States.Num() - 1);
+        }
     }
 }
 
 void AMineableResource::UpdateMeshState()
 {
-    if (ResourceStates.IsValidIndex(CurrentStateIndex))
+    const TArray<FResourceState>& States = GetResourceStates();
+    if (States.IsValidIndex(CurrentStateIndex))
     {
         // Update resource amount and mesh for current state
-        RemainingResource = ResourceStates[CurrentStateIndex].ResourceAmount;
+        RemainingResource = States[CurrentStateIndex].ResourceAmount;
 
-        if (ResourceStates[CurrentStateIndex].ResourceMesh)
+        if (States[CurrentStateIndex].ResourceMesh)
         {
-            ResourceMesh->SetStaticMesh(ResourceStates[CurrentStateIndex].ResourceMesh);
+            ResourceMesh->SetStaticMesh(States[CurrentStateIndex].ResourceMesh);
             ResourceMesh->SetVisibility(true);
         }
         else
@@ -61,12 +126,13 @@ void AMineableResource::PostEditChangeProperty(FPropertyChangedEvent& PropertyCh
         ? PropertyChangedEvent.Property->GetFName()
         : NAME_None;
 
-    if (ResourceStates.Num() > 0)
+    if (GetResourceStates().Num() > 0)
     {
         ValidateIndices();
 
         // Update visual state when relevant properties change in editor
         if (PropertyName == GET_MEMBER_NAME_CHECKED(AMineableResource, CurrentStateIndex) ||
+            PropertyName == GET_MEMBER_NAME_CHECKED(AMineableResource, Definition) ||
             PropertyName == GET_MEMBER_NAME_CHECKED(AMineableResource, ResourceStates) ||
             PropertyName == GET_MEMBER_NAME_CHECKED(FResourceState, ResourceMesh) ||
             PropertyName == GET_MEMBER_NAME_CHECKED(FResourceState, ResourceAmount))
@@ -77,21 +143,41 @@ void AMineableResource::PostEditChangeProperty(FPropertyChangedEvent& PropertyCh
 }
 #endif
 
-void AMineableResource::UpdateStateBasedOnResource()
+int32 AMineableResource::FindStateForAmount(const TArray<FResourceState>& States, int32 Remaining)
 {
     // Iterate through states from most depleted to most full
-    for (int32 i = ResourceStates.Num() - 1; i >= 0; --i)
+    for (int32 i = States.Num() - 1; i >= 0; --i)
     {
-        if (RemainingResource <= ResourceStates[i].ResourceAmount)
+        if (Remaining <= States[i].ResourceAmount)
         {
-            if (CurrentStateIndex != i)
-            {
-                CurrentStateIndex = i;
-                UpdateMeshState();
-            }
-            break;
+            return i;
         }
     }
+    return INDEX_NONE;
+}
+
+void AMineableResource::UpdateStateBasedOnResource()
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalResourceState);
+    SURVIVAL_DEBUG_TIMER(ResourceState);
+
+    const int32 NewStateIndex = FindStateIndex(RemainingResource);
+    if (NewStateIndex != INDEX_NONE && CurrentStateIndex != NewStateIndex)
+    {
+        CurrentStateIndex = NewStateIndex;
+        UpdateMeshState();
+        INC_DWORD_STAT(STAT_SurvivalResourceStateSwaps);
+    }
+}
+
+void AMineableResource::RestoreState(int32 StateIndex, int32 Remaining)
+{
+    CurrentStateIndex = StateIndex;
+    ValidateIndices();
+    UpdateMeshState();
+
+    // UpdateMeshState resets the amount to the state's full value
+    RemainingResource = Remaining;
 }
 
 int32 AMineableResource::Mine(int32 AmountToMine)
@@ -103,6 +189,15 @@ int32 AMineableResource::Mine(int32 AmountToMine)
     RemainingResource -= ActualMined;
 
     UpdateStateBasedOnResource();
+
+    // Depletion hands the resource to the respawn scheduler, it needs no timer of its own
+    if (IsDepleted() && GetRespawnSeconds() > 0.0f && UResourceRespawnSubsystem::IsEnabled())
+    {
+        if (UResourceRespawnSubsystem* ResourceRespawn = GetWorld()->GetSubsystem<UResourceRespawnSubsystem>())
+        {
+            ResourceRespawn->ScheduleRespawn(this, GetRespawnSeconds());
+        }
+    }
     return ActualMined;
 }
 
@@ -115,10 +210,7 @@ int32 AMineableResource::MineChunk()
 
 int32 AMineableResource::GetCurrentChunkAmount() const
 {
-    if (IsDepleted() || !ResourceStates.IsValidIndex(CurrentStateIndex + 1)) return 0;
-
-    // Calculate chunk size based on difference between current and next state
-    return RemainingResource - ResourceStates[CurrentStateIndex + 1].ResourceAmount;
+    return GetChunkAmount(CurrentStateIndex, RemainingResource);
 }
 
 bool AMineableResource::IsDepleted() const
@@ -129,4 +221,22 @@ bool AMineableResource::IsDepleted() const
 int32 AMineableResource::GetRemainingResource() const
 {
     return RemainingResource;
+}
+
+FInteractionResult AMineableResource::GetInteraction(int32 Item) const
+{
+    FInteractionResult Result;
+    Result.ResourceType = ResourceType;
+    Result.Amount = GetCurrentChunkAmount();
+    Result.StaminaCost = Result.Amount * StaminaCostPerUnit;
+    return Result;
+}
+
+FInteractionResult AMineableResource::Interact(AActor* Instigator, int32 Item)
+{
+    FInteractionResult Result;
+    Result.ResourceType = ResourceType;
+    Result.Amount = MineChunk();
+    Result.StaminaCost = Result.Amount * StaminaCostPerUnit;
+    return Result;
 }
\ No newline at end of file
@@ -1,47 +1,97 @@
 #include "ObjectivesWidget.h"
 #include "PlayerCharacter.h"
 #include "Components/TextBlock.h"
+#include "TimerManager.h"
+#include "GAM312Survival.h"
 
 void UObjectivesWidget::NativeConstruct()
 {
     Super::NativeConstruct();
-    PlayerCharacter = Cast<APlayerCharacter>(GetOwningPlayerPawn());
+
+    // Safely get player character reference
+    if (!PlayerCharacter.IsValid())
+    {
+        BindToCharacter(Cast<APlayerCharacter>(GetOwningPlayerPawn()));
+    }
 }
 
-void UObjectivesWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+void UObjectivesWidget::NativeDestruct()
 {
-    Super::NativeTick(MyGeometry, InDeltaTime);
     if (PlayerCharacter.IsValid())
     {
-        RefreshObjectiveDisplay();
-        CheckEndCondition(InDeltaTime);
+        PlayerCharacter->OnObjectiveProgressChanged.RemoveDynamic(this, &UObjectivesWidget::HandleObjectiveProgress);
     }
-    else
+    PlayerCharacter.Reset();
+
+    if (UWorld* World = GetWorld())
     {
-        // Safely get player character reference
-        PlayerCharacter = Cast<APlayerCharacter>(GetOwningPlayerPawn());
+        World->GetTimerManager().ClearTimer(CountdownTimerHandle);
     }
+
+    Super::NativeDestruct();
+}
+
+void UObjectivesWidget::BindToCharacter(APlayerCharacter* Character)
+{
+    if (!Character || PlayerCharacter == Character) return;
+
+    if (PlayerCharacter.IsValid())
+    {
+        PlayerCharacter->OnObjectiveProgressChanged.RemoveDynamic(this, &UObjectivesWidget::HandleObjectiveProgress);
+    }
+
+    PlayerCharacter = Character;
+    PlayerCharacter->OnObjectiveProgressChanged.AddDynamic(this, &UObjectivesWidget::HandleObjectiveProgress);
+
+    // Show the current progress, later updates arrive through the delegate
+    HandleObjectiveProgress(Character->GetTotalMaterialsCollected(), Character->GetBuildPartsCount());
+    RefreshTimeRemaining();
+
+    GetWorld()->GetTimerManager().SetTimer(
+        CountdownTimerHandle,
+        this,
+        &UObjectivesWidget::UpdateCountdown,
+        CountdownInterval,
+        true // Loop indefinitely
+    );
 }
 
 void UObjectivesWidget::SetTimeLeft(float TimeLeft)
 {
     TimeElapsed = LosingTime - TimeLeft;
+    RefreshTimeRemaining();
 }
 
-void UObjectivesWidget::RefreshObjectiveDisplay()
+void UObjectivesWidget::HandleObjectiveProgress(int32 TotalMaterials, int32 BuildParts)
 {
-    if (!PlayerCharacter.IsValid()) return;
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalWidgetRefresh);
+    INC_DWORD_STAT(STAT_SurvivalWidgetRefreshes);
 
     // Format materials objective text
-    FString MaterialsText = FString::Printf(TEXT("Collect Materials: %d/500"),
-                                            PlayerCharacter->GetTotalMaterialsCollected());
+    FString MaterialsText = FString::Printf(TEXT("Collect Materials: %d/500"), TotalMaterials);
     MaterialsObjectiveText->SetText(FText::FromString(MaterialsText));
 
     // Format building objective text
-    FString BuildText = FString::Printf(TEXT("Build Parts: %d/5"),
-                                        PlayerCharacter->GetBuildPartsCount());
+    FString BuildText = FString::Printf(TEXT("Build Parts: %d/5"), BuildParts);
     BuildObjectiveText->SetText(FText::FromString(BuildText));
 
+    CheckEndCondition();
+}
+
+void UObjectivesWidget::UpdateCountdown()
+{
+    if (bHasTriggeredTimeout) return;
+
+    TimeElapsed += CountdownInterval;
+    RefreshTimeRemaining();
+    CheckEndCondition();
+}
+
+void UObjectivesWidget::RefreshTimeRemaining()
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalWidgetRefresh);
+    INC_DWORD_STAT(STAT_SurvivalWidgetRefreshes);
+
     float RemainingSeconds = FMath::Max(0.0f, LosingTime - TimeElapsed);
     int32 Minutes = FMath::FloorToInt(RemainingSeconds / 60);
     int32 Seconds = FMath::FloorToInt(RemainingSeconds) % 60;
@@ -50,8 +100,10 @@ void UObjectivesWidget::RefreshObjectiveDisplay()
     TimeRemainingText->SetText(FText::FromString(TimerString));
 }
 
-void UObjectivesWidget::CheckEndCondition(float InDeltaTime)
+void UObjectivesWidget::CheckEndCondition()
 {
+    if (!PlayerCharacter.IsValid()) return;
+
     // Handle completion status
     bool bAllComplete = PlayerCharacter->GetTotalMaterialsCollected() >= 500 &&
                         PlayerCharacter->GetBuildPartsCount() >= 5;
@@ -60,13 +112,9 @@ void UObjectivesWidget::CheckEndCondition(float InDeltaTime)
     {
         PlayerCharacter->ShowEndGameWidget(true); // 'true' means win
     }
-    else if (!bHasTriggeredTimeout)
+    else if (!bHasTriggeredTimeout && TimeElapsed >= LosingTime)
     {
-        TimeElapsed += InDeltaTime;
-        if (TimeElapsed >= LosingTime)
-        {
-            bHasTriggeredTimeout = true;
-            PlayerCharacter->ShowEndGameWidget(false); // 'false' means lose
-        }
+        bHasTriggeredTimeout = true;
+        PlayerCharacter->ShowEndGameWidget(false); // 'false' means lose
     }
 }
@@ -1,9 +1,10 @@
 #include "PlayerCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "DrawDebugHelpers.h"
-#include "BerryBush.h"
-#include "MineableResource.h"
 #include "GameFramework/PlayerController.h"
+#include "BuildablePoolSubsystem.h"
+#include "StructureGridSubsystem.h"
+#include "GAM312Survival.h"
 
 APlayerCharacter::APlayerCharacter()
 {
@@ -15,6 +16,9 @@ APlayerCharacter::APlayerCharacter()
     FirstPersonCamera->SetupAttachment(GetMesh(), "head"); // Attach to skeleton mesh head socket
     FirstPersonCamera->bUsePawnControlRotation = true; // Camera follows controller rotation
 
+    // Survival stats live in the stats subsystem, the component only configures them
+    StatsComponent = CreateDefaultSubobject<USurvivalStatsComponent>(TEXT("SurvivalStats"));
+
     // Configure character movement behavior
     GetCharacterMovement()->bOrientRotationToMovement = false; // Don't rotate toward movement direction
     bUseControllerRotationPitch = false; // Prevent pitch rotation from controller
@@ -26,6 +30,47 @@ APlayerCharacter::APlayerCharacter()
     MenuWidgetInstance = nullptr;
 }
 
+void APlayerCharacter::PostLoad()
+{
+    Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+    if (!StatsComponent) return;
+
+    auto MigrateStat = [](float& Deprecated, float& Target)
+    {
+        if (Deprecated >= 0.0f)
+        {
+            Target = Deprecated;
+            Deprecated = -1.0f;
+        }
+    };
+    MigrateStat(MaxHealth_DEPRECATED, StatsComponent->MaxHealth);
+    MigrateStat(MaxHunger_DEPRECATED, StatsComponent->MaxHunger);
+    MigrateStat(MaxStamina_DEPRECATED, StatsComponent->MaxStamina);
+    MigrateStat(CurrentHealth_DEPRECATED, StatsComponent->InitialHealth);
+    MigrateStat(CurrentHunger_DEPRECATED, StatsComponent->InitialHunger);
+    MigrateStat(CurrentStamina_DEPRECATED, StatsComponent->InitialStamina);
+    MigrateStat(StaminaRestoreRate_DEPRECATED, StatsComponent->StaminaRestoreRate);
+    MigrateStat(StaminaDecreaseRate_DEPRECATED, StatsComponent->StaminaDrainRate);
+
+    // Hunger and starvation were applied once per update, the component rates are per second
+    const bool bHasHungerInterval = HungerUpdateInterval_DEPRECATED > 0.0f;
+    const float HungerInterval = bHasHungerInterval ? HungerUpdateInterval_DEPRECATED : 1.0f;
+    auto MigrateHungerRate = [bHasHungerInterval, HungerInterval](float& Deprecated, float OldDefault, float& Target)
+    {
+        if (Deprecated >= 0.0f || bHasHungerInterval)
+        {
+            Target = (Deprecated >= 0.0f ? Deprecated : OldDefault) / HungerInterval;
+            Deprecated = -1.0f;
+        }
+    };
+    MigrateHungerRate(HungerDecreaseRate_DEPRECATED, 1.0f, StatsComponent->HungerDecayRate);
+    MigrateHungerRate(StarvationDamageRate_DEPRECATED, 5.0f, StatsComponent->StarvationDamageRate);
+    HungerUpdateInterval_DEPRECATED = -1.0f;
+#endif
+}
+
 void APlayerCharacter::ShowEndGameWidget(bool bWon)
 {
     APlayerController* PC = Cast<APlayerController>(GetController());
@@ -57,27 +102,9 @@ void APlayerCharacter::BeginPlay()
 {
     Super::BeginPlay();
 
-    // Initialize survival stats with safe values
-    CurrentHealth = InitializeStat(CurrentHealth, MaxHealth);
-    CurrentHunger = InitializeStat(CurrentHunger, MaxHunger);
-    CurrentStamina = InitializeStat(CurrentStamina, MaxStamina);
-
-    // Set up recurring stat updates
-    GetWorld()->GetTimerManager().SetTimer(
-        HungerTimerHandle,
-        this,
-        &APlayerCharacter::UpdateHunger,
-        HungerUpdateInterval,
-        true // Loop indefinitely
-    );
-
-    GetWorld()->GetTimerManager().SetTimer(
-        StaminaRestoreTimerHandle,
-        this,
-        &APlayerCharacter::UpdateStamina,
-        StaminaUpdateInterval,
-        true // Loop indefinitely
-    );
+    // Sync stat state configured on the character
+    StatsComponent->SetStaminaDraining(bIsStaminaDraining);
+    StatsComponent->OnHealthDepleted.AddDynamic(this, &APlayerCharacter::HandleHealthDepleted);
 
     // Create persistent stats HUD widget
     if (StatsWidgetClass)
@@ -86,45 +113,26 @@ void APlayerCharacter::BeginPlay()
         if (StatsWidgetInstance)
         {
             StatsWidgetInstance->AddToViewport();
+            StatsWidgetInstance->BindToCharacter(this);
         }
     }
-}
-
-float APlayerCharacter::InitializeStat(float CurrentValue, float MaxValue)
-{
-    // Ensure valid starting values
-    return (CurrentValue <= 0 || CurrentValue > MaxValue) ? MaxValue : CurrentValue;
-}
-
-void APlayerCharacter::UpdateHunger()
-{
-    // Gradually reduce hunger
-    SetHunger(CurrentHunger - HungerDecreaseRate);
 
-    // Apply damage when starving
-    if (CurrentHunger <= 0.0f)
+    if (bShowDebugStats)
     {
-        SetHealth(CurrentHealth - StarvationDamageRate);
+        DebugOverlay = MakeUnique<FSurvivalDebugOverlay>(this, DebugStatsRefreshInterval);
     }
 }
 
-void APlayerCharacter::UpdateStamina()
+void APlayerCharacter::HandleHealthDepleted()
 {
-    // Calculate stamina change based on current state
-    float staminaChange = bIsStaminaDraining
-        ? -(StaminaDecreaseRate * StaminaUpdateInterval)  // Active drain
-        : (StaminaRestoreRate * StaminaUpdateInterval);   // Passive recovery
-
-    SetStamina(CurrentStamina + staminaChange);
+    ShowEndGameWidget(false);
 }
 
 void APlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     Super::EndPlay(EndPlayReason);
 
-    // Cleanup timers to prevent lingering updates
-    GetWorld()->GetTimerManager().ClearTimer(HungerTimerHandle);
-    GetWorld()->GetTimerManager().ClearTimer(StaminaRestoreTimerHandle);
+    DebugOverlay.Reset();
 
     // Cleanup existing UI
     if (MenuWidgetInstance) MenuWidgetInstance->RemoveFromParent();
@@ -140,26 +148,6 @@ void APlayerCharacter::Tick(float DeltaTime)
     {
         UpdatePreview();
     }
-
-    // Display debug information
-    if (bShowDebugStats && GEngine)
-    {
-        FString StatsText = FString::Printf(TEXT(
-            "Health: %.1f\nHunger: %.1f\nStamina: %.1f\n"
-            "Inventory:\n"
-            "- Wood: %d\n"
-            "- Stone: %d\n"
-            "- Berries: %d"
-        ),
-        CurrentHealth, CurrentHunger, CurrentStamina,
-        CurrentWood, CurrentStone, CurrentBerries);
-
-        if (bIsBuildingMode) {
-            StatsText += "\nCurrently Building";
-        }
-
-        GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::White, StatsText);
-    }
 }
 
 void APlayerCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -196,29 +184,32 @@ void APlayerCharacter::RotatePreviewYaw(float Value)
 {
     if (bIsBuildingMode && PreviewBuildable)
     {
-        FRotator NewRotation = PreviewBuildable->GetActorRotation();
-        NewRotation.Yaw += Value;
-        PreviewBuildable->SetActorRotation(NewRotation);
+        // Snapped parts only face the four grid directions, so turn a full quarter at a time
+        PreviewYaw += UStructureGridSubsystem::IsEnabled() ? FMath::Sign(Value) * 90.0f : Value;
+        bPreviewDirty = true;
     }
 }
 
 void APlayerCharacter::StartBuilding(TSubclassOf<ABuildableBase> BuildableToPlace)
 {
-    if (BuildableToPlace && !bIsBuildingMode)
+    UBuildablePoolSubsystem* BuildablePool = GetWorld()->GetSubsystem<UBuildablePoolSubsystem>();
+    if (BuildableToPlace && BuildablePool && !bIsBuildingMode)
     {
         CancelBuilding(); // Cleanup existing preview
         bIsBuildingMode = true;
         bIsMenuOpen = false;
 
-        // Spawn preview actor
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-        PreviewBuildable = GetWorld()->SpawnActor<ABuildableBase>(
-            BuildableToPlace, 
-            FVector::ZeroVector, 
-            FRotator::ZeroRotator, 
-            SpawnParams
+        // Reuse a preview actor from an earlier session, and have placement actors ready
+        PreviewBuildable = BuildablePool->Acquire(
+            BuildableToPlace,
+            FTransform::Identity,
+            ESpawnActorCollisionHandlingMethod::AlwaysSpawn
         );
+        BuildablePool->Prewarm(BuildableToPlace);
+
+        PreviewYaw = 0.0f;
+        bPreviewDirty = true;
+        PreviewTraceHandle = FTraceHandle();
 
         if (PreviewBuildable)
         {
@@ -230,17 +221,78 @@ void APlayerCharacter::StartBuilding(TSubclassOf<ABuildableBase> BuildableToPlac
 
 void APlayerCharacter::UpdatePreview()
 {
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalBuildPreview);
+    SURVIVAL_DEBUG_TIMER(BuildPreview);
+
     if (!PreviewBuildable) return;
 
     // Calculate preview position based on camera look direction
-    FVector Start = FirstPersonCamera->GetComponentLocation();
+    const FTransform CameraTransform = FirstPersonCamera->GetComponentTransform();
+    FVector Start = CameraTransform.GetLocation();
     FVector End = Start + FirstPersonCamera->GetForwardVector() * InteractionRange * 2;
+    UWorld* World = GetWorld();
+
+    if (!bAsyncPreviewTrace)
+    {
+        INC_DWORD_STAT(STAT_SurvivalPreviewTraces);
+        ++NumPreviewTraces;
+        if (World->LineTraceSingleByChannel(PreviewHit, Start, End, ECC_Visibility))
+        {
+            ApplyPreviewHit();
+        }
+        return;
+    }
+
+    // Consume the trace issued last frame, it ran alongside the rest of that frame
+    FTraceDatum TraceData;
+    if (World->QueryTraceData(PreviewTraceHandle, TraceData))
+    {
+        PreviewTraceHandle = FTraceHandle();
+        if (TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit)
+        {
+            PreviewHit = TraceData.OutHits[0];
+            ApplyPreviewHit();
+        }
+    }
+
+    // A still camera aims at the same spot, so only trace again once it moved, one trace in flight at a time
+    const bool bCameraMoved =
+        FVector::DistSquared(CameraTransform.GetLocation(), PreviewTraceCamera.GetLocation()) > FMath::Square(PreviewCameraMoveThreshold) ||
+        CameraTransform.GetRotation().AngularDistance(PreviewTraceCamera.GetRotation()) > FMath::DegreesToRadians(PreviewCameraRotateThreshold);
+
+    if ((bCameraMoved || bPreviewDirty) && !World->IsTraceHandleValid(PreviewTraceHandle, false))
+    {
+        const FCollisionQueryParams Params(SCENE_QUERY_STAT(BuildPreview), false, this);
+        PreviewTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, ECC_Visibility, Params);
+        PreviewTraceCamera = CameraTransform;
+        bPreviewDirty = false;
+
+        INC_DWORD_STAT(STAT_SurvivalPreviewTraces);
+        ++NumPreviewTraces;
+    }
+}
+
+void APlayerCharacter::ApplyPreviewHit()
+{
+    FVector Location = PreviewHit.Location + PreviewHit.Normal * 10.0f; // Offset from surface
+    FQuat Rotation = FRotator(0.0f, PreviewYaw, 0.0f).Quaternion();
 
-    FHitResult Hit;
-    if (GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility))
+    // Snap to the nearest socket of the structure grid for the preview's type
+    const UStructureGridSubsystem* StructureGrid = GetWorld()->GetSubsystem<UStructureGridSubsystem>();
+    if (UStructureGridSubsystem::IsEnabled() && StructureGrid)
     {
-        PreviewBuildable->SetActorLocation(Hit.Location + Hit.Normal * 10.0f); // Offset from surface
+        const FStructureGrid& Grid = StructureGrid->GetGrid();
+        PreviewBuildable->GridSlot = Grid.FindSnapSlot(PreviewBuildable->BuildableType, Location);
+
+        const FTransform SnapTransform = Grid.GetSlotTransform(PreviewBuildable->GridSlot, PreviewYaw);
+        Location = SnapTransform.GetLocation();
+        Rotation = SnapTransform.GetRotation();
     }
+
+    // Location and rotation go through one transform update, none at all if the preview stays put
+    if (PreviewBuildable->GetActorLocation().Equals(Location) && PreviewBuildable->GetActorQuat().Equals(Rotation)) return;
+
+    PreviewBuildable->SetActorLocationAndRotation(Location, Rotation);
 }
 
 void APlayerCharacter::PlaceBuildable()
@@ -257,16 +309,24 @@ void APlayerCharacter::PlaceBuildable()
     case EMaterialType::Stone: AvailableResource = CurrentStone; break;
     }
 
-    if (PreviewBuildable->CanAfford(AvailableResource))
-    {
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding;
+    // Snapped previews are validated against the structure grid, which replaces the overlap check on spawn
+    const bool bSnapped = UStructureGridSubsystem::IsEnabled();
+    if (!PreviewBuildable->IsValidPlacement(PreviewHit)) return;
 
-        if (ABuildableBase* NewBuildable = GetWorld()->SpawnActor<ABuildableBase>(
-            PreviewBuildable->GetClass(), 
-            PreviewBuildable->GetActorTransform(), 
-            SpawnParams))
+    UBuildablePoolSubsystem* BuildablePool = GetWorld()->GetSubsystem<UBuildablePoolSubsystem>();
+    if (BuildablePool && PreviewBuildable->CanAfford(AvailableResource))
+    {
+        if (ABuildableBase* NewBuildable = BuildablePool->Acquire(
+            PreviewBuildable->GetClass(),
+            PreviewBuildable->GetActorTransform(),
+            bSnapped ? ESpawnActorCollisionHandlingMethod::AlwaysSpawn : ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding))
         {
+            const UStructureGridSubsystem* StructureGrid = GetWorld()->GetSubsystem<UStructureGridSubsystem>();
+            if (bSnapped && StructureGrid)
+            {
+                NewBuildable->OccupyGridSlot(PreviewBuildable->GridSlot, StructureGrid->IsGroundHit(PreviewHit, PreviewBuildable->GridSlot));
+            }
+
             // Deduct resources
             switch (PreviewBuildable->MaterialType)
             {
@@ -275,7 +335,11 @@ void APlayerCharacter::PlaceBuildable()
             }
 
             NewBuildable->PlayPlacementEffect(); // Visual feedback
+
+            // The placed part now blocks the preview's slot, re-trace even if the camera holds still
+            bPreviewDirty = true;
             BuildPartsCount++; // Track objective progress
+            OnObjectiveProgressChanged.Broadcast(TotalMaterialsCollected, BuildPartsCount);
         }
     }
 }
@@ -284,8 +348,17 @@ void APlayerCharacter::CancelBuilding()
 {
     if (PreviewBuildable)
     {
-        PreviewBuildable->Destroy();
+        // Keep the preview for the next session
+        if (UBuildablePoolSubsystem* BuildablePool = GetWorld()->GetSubsystem<UBuildablePoolSubsystem>())
+        {
+            BuildablePool->Release(PreviewBuildable);
+        }
+        else
+        {
+            PreviewBuildable->Destroy();
+        }
         PreviewBuildable = nullptr;
+        PreviewTraceHandle = FTraceHandle();
     }
     bIsBuildingMode = false;
 }
@@ -323,47 +396,75 @@ void APlayerCharacter::ToggleMenu()
     }
 }
 
-void APlayerCharacter::CheckInteraction()
+FInteractionTarget APlayerCharacter::FindInteractionTarget() const
 {
-    if (bIsMenuOpen || bIsBuildingMode) return;
+    FVector Start = FirstPersonCamera->GetComponentLocation();
+    FVector Direction = FirstPersonCamera->GetForwardVector();
+
+    // Resolve the target from the spatial index without a full trace
+    UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>();
+    if (bUseInteractionIndex && InteractableIndex)
+    {
+        FInteractableQuery Query;
+        Query.ViewLocation = Start;
+        Query.ViewDirection = Direction;
+        Query.Range = InteractionRange;
+        Query.ConeHalfAngle = InteractionConeAngle;
+        Query.bTraceForOcclusion = bInteractionOcclusionTrace;
+        Query.IgnoredActor = this;
+        return InteractableIndex->FindInteractable(Query);
+    }
 
     // Perform interaction trace
-    FVector Start = FirstPersonCamera->GetComponentLocation();
-    FVector End = Start + (FirstPersonCamera->GetForwardVector() * InteractionRange);
+    FVector End = Start + (Direction * InteractionRange);
 
     FHitResult HitResult;
     FCollisionQueryParams QueryParams;
     QueryParams.AddIgnoredActor(this);
 
+    FInteractionTarget Target;
     if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams))
     {
-        // Berry Bush interaction
-        if (ABerryBush* BerryBush = Cast<ABerryBush>(HitResult.GetActor()))
-        {
-            if (!BerryBush->bIsCollected && GetStamina() >= 3.0f)
-            {
-                BerryBush->CollectBerry();
-                SetStamina(GetStamina() - 3.0f);
-                SetBerries(GetBerries() + 1);
-            }
-        }
-        // Mineable Resource interaction
-        else if (AMineableResource* Resource = Cast<AMineableResource>(HitResult.GetActor()))
+        Target.Actor = HitResult.GetActor();
+        Target.Interactable = Cast<IInteractable>(Target.Actor);
+        if (Target.Interactable)
         {
-            if (!Resource->IsDepleted() && GetStamina() >= Resource->GetCurrentChunkAmount() * 3.0f)
-            {
-                int32 AmountMined = Resource->MineChunk();
-                SetStamina(GetStamina() - AmountMined * 3.0f);
-                
-                switch (Resource->ResourceType)
-                {
-                    case EResourceType::Wood: SetWood(GetWood() + AmountMined); break;
-                    case EResourceType::Stone: SetStone(GetStone() + AmountMined); break;
-                    case EResourceType::Berry: SetBerries(GetBerries() + AmountMined); break;
-                }
-            }
+            Target.Item = Target.Interactable->GetItemForHit(HitResult);
         }
     }
+    return Target;
+}
+
+void APlayerCharacter::CheckInteraction()
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalInteraction);
+    SURVIVAL_DEBUG_TIMER(Interaction);
+
+    if (bIsMenuOpen || bIsBuildingMode) return;
+
+    FInteractionTarget Target = FindInteractionTarget();
+    if (!Target.IsValid()) return;
+
+    // Preview first so nothing is consumed when the player is too exhausted
+    const FInteractionResult Preview = Target.Interactable->GetInteraction(Target.Item);
+    if (Preview.IsValid() && GetStamina() >= Preview.StaminaCost)
+    {
+        const FInteractionResult Result = Target.Interactable->Interact(this, Target.Item);
+        SetStamina(GetStamina() - Result.StaminaCost);
+        AddResource(Result.ResourceType, Result.Amount);
+    }
+}
+
+void APlayerCharacter::AddResource(EResourceType ResourceType, int32 Amount)
+{
+    if (Amount <= 0) return;
+
+    switch (ResourceType)
+    {
+        case EResourceType::Wood: SetWood(GetWood() + Amount); break;
+        case EResourceType::Stone: SetStone(GetStone() + Amount); break;
+        case EResourceType::Berry: SetBerries(GetBerries() + Amount); break;
+    }
 }
 
 // Movement Implementation
@@ -414,17 +515,18 @@ void APlayerCharacter::Jump()
 void APlayerCharacter::ToggleStaminaDrain()
 {
     bIsStaminaDraining = !bIsStaminaDraining;
+    StatsComponent->SetStaminaDraining(bIsStaminaDraining);
 }
 
 // Stat Getters
 
-float APlayerCharacter::GetHealth() const { return CurrentHealth; }
-float APlayerCharacter::GetHunger() const { return CurrentHunger; }
-float APlayerCharacter::GetStamina() const { return CurrentStamina; }
+float APlayerCharacter::GetHealth() const { return StatsComponent->GetStat(ESurvivalStat::Health); }
+float APlayerCharacter::GetHunger() const { return StatsComponent->GetStat(ESurvivalStat::Hunger); }
+float APlayerCharacter::GetStamina() const { return StatsComponent->GetStat(ESurvivalStat::Stamina); }
 
-float APlayerCharacter::GetMaxHealth() const { return MaxHealth; }
-float APlayerCharacter::GetMaxHunger() const { return MaxHunger; }
-float APlayerCharacter::GetMaxStamina() const { return MaxStamina; }
+float APlayerCharacter::GetMaxHealth() const { return StatsComponent->GetMaxStat(ESurvivalStat::Health); }
+float APlayerCharacter::GetMaxHunger() const { return StatsComponent->GetMaxStat(ESurvivalStat::Hunger); }
+float APlayerCharacter::GetMaxStamina() const { return StatsComponent->GetMaxStat(ESurvivalStat::Stamina); }
 
 // Inventory Getters
 
@@ -434,22 +536,21 @@ int APlayerCharacter::GetBerries() const { return CurrentBerries; }
 int APlayerCharacter::GetTotalMaterialsCollected() const { return TotalMaterialsCollected; }
 int APlayerCharacter::GetBuildPartsCount() const { return BuildPartsCount; }
 
-// Stat Setters (With clamping)
+// Stat Setters (Clamped by the stats component)
 
 void APlayerCharacter::SetHealth(float NewHealth)
 {
-    CurrentHealth = FMath::Clamp(NewHealth, 0.0f, MaxHealth);
-    if (CurrentHealth <= 0.0f) ShowEndGameWidget(false);
+    StatsComponent->SetStat(ESurvivalStat::Health, NewHealth);
 }
 
 void APlayerCharacter::SetHunger(float NewHunger)
 {
-    CurrentHunger = FMath::Clamp(NewHunger, 0.0f, MaxHunger);
+    StatsComponent->SetStat(ESurvivalStat::Hunger, NewHunger);
 }
 
 void APlayerCharacter::SetStamina(float NewStamina)
 {
-    CurrentStamina = FMath::Clamp(NewStamina, 0.0f, MaxStamina);
+    StatsComponent->SetStat(ESurvivalStat::Stamina, NewStamina);
 }
 
 // Inventory Setters (With clamping and material tracking)
@@ -457,27 +558,42 @@ void APlayerCharacter::SetWood(int NewWood)
 {
     int Delta = FMath::Clamp(NewWood, 0, MaxItemSlot) - CurrentWood;
     CurrentWood = NewWood;
-    if (Delta > 0) TotalMaterialsCollected += Delta;
+    if (Delta > 0) AddCollectedMaterials(Delta);
 }
 
 void APlayerCharacter::SetStone(int NewStone)
 {
     int Delta = FMath::Clamp(NewStone, 0, MaxItemSlot) - CurrentStone;
     CurrentStone = NewStone;
-    if (Delta > 0) TotalMaterialsCollected += Delta;
+    if (Delta > 0) AddCollectedMaterials(Delta);
 }
 
 void APlayerCharacter::SetBerries(int NewBerries)
 {
     int Delta = FMath::Clamp(NewBerries, 0, MaxItemSlot) - CurrentBerries;
     CurrentBerries = NewBerries;
-    if (Delta > 0) TotalMaterialsCollected += Delta;
+    if (Delta > 0) AddCollectedMaterials(Delta);
+}
+
+void APlayerCharacter::AddCollectedMaterials(int32 Amount)
+{
+    TotalMaterialsCollected += Amount;
+    OnObjectiveProgressChanged.Broadcast(TotalMaterialsCollected, BuildPartsCount);
 }
 
 // Debug
 void APlayerCharacter::ToggleDebugStats()
 {
     bShowDebugStats = !bShowDebugStats;
+
+    if (bShowDebugStats)
+    {
+        DebugOverlay = MakeUnique<FSurvivalDebugOverlay>(this, DebugStatsRefreshInterval);
+    }
+    else
+    {
+        DebugOverlay.Reset();
+    }
 }
 
 void APlayerCharacter::SetTimeLeft(float TimeLeft)
@@ -1,45 +1,73 @@
 #include "PlayerStatsWidget.h"
 #include "PlayerCharacter.h"
+#include "SurvivalStatsComponent.h"
 #include "Components/TextBlock.h"
+#include "GAM312Survival.h"
 
 void UPlayerStatsWidget::NativeConstruct()
 {
     Super::NativeConstruct();
 
     // Safely get player character reference
-    PlayerCharacter = Cast<APlayerCharacter>(GetOwningPlayerPawn());
+    if (!StatsComponent.IsValid())
+    {
+        BindToCharacter(Cast<APlayerCharacter>(GetOwningPlayerPawn()));
+    }
+}
+
+void UPlayerStatsWidget::NativeDestruct()
+{
+    if (StatsComponent.IsValid())
+    {
+        StatsComponent->OnStatChanged.RemoveDynamic(this, &UPlayerStatsWidget::HandleStatChanged);
+    }
+    StatsComponent.Reset();
+
+    Super::NativeDestruct();
 }
 
-void UPlayerStatsWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+void UPlayerStatsWidget::BindToCharacter(APlayerCharacter* Character)
 {
-    Super::NativeTick(MyGeometry, InDeltaTime);
+    USurvivalStatsComponent* NewStats = Character ? Character->GetStatsComponent() : nullptr;
+    if (!NewStats || StatsComponent == NewStats) return;
+
+    if (StatsComponent.IsValid())
+    {
+        StatsComponent->OnStatChanged.RemoveDynamic(this, &UPlayerStatsWidget::HandleStatChanged);
+    }
+
+    StatsComponent = NewStats;
+    StatsComponent->OnStatChanged.AddDynamic(this, &UPlayerStatsWidget::HandleStatChanged);
+
+    if (ObjectivesWidget)
+    {
+        ObjectivesWidget->BindToCharacter(Character);
+    }
 
-    if (PlayerCharacter.IsValid() && HealthValueText && HungerValueText && StaminaValueText)
+    // Show the current values, later updates arrive through the delegate
+    for (const ESurvivalStat Stat : { ESurvivalStat::Health, ESurvivalStat::Hunger, ESurvivalStat::Stamina })
     {
-        // Format and update health display
-        HealthValueText->SetText(FormatStatText(
-            PlayerCharacter->GetHealth(),
-            PlayerCharacter->GetMaxHealth(),
-            TEXT("Health")
-        ));
-
-        // Format and update hunger display
-        HungerValueText->SetText(FormatStatText(
-            PlayerCharacter->GetHunger(),
-            PlayerCharacter->GetMaxHunger(),
-            TEXT("Hunger")
-        ));
-
-        // Format and update stamina display
-        StaminaValueText->SetText(FormatStatText(
-            PlayerCharacter->GetStamina(),
-            PlayerCharacter->GetMaxStamina(),
-            TEXT("Stamina")
-        ));
+        HandleStatChanged(Stat, NewStats->GetStat(Stat), NewStats->GetMaxStat(Stat));
     }
-    else
+}
+
+void UPlayerStatsWidget::HandleStatChanged(ESurvivalStat Stat, float Value, float MaxValue)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalWidgetRefresh);
+    INC_DWORD_STAT(STAT_SurvivalWidgetRefreshes);
+    ++NumRefreshes;
+
+    switch (Stat)
     {
-        PlayerCharacter = Cast<APlayerCharacter>(GetOwningPlayerPawn());
+    case ESurvivalStat::Health:
+        if (HealthValueText) HealthValueText->SetText(FormatStatText(Value, MaxValue, TEXT("Health")));
+        break;
+    case ESurvivalStat::Hunger:
+        if (HungerValueText) HungerValueText->SetText(FormatStatText(Value, MaxValue, TEXT("Hunger")));
+        break;
+    case ESurvivalStat::Stamina:
+        if (StaminaValueText) StaminaValueText->SetText(FormatStatText(Value, MaxValue, TEXT("Stamina")));
+        break;
     }
 }
 
@@ -52,4 +80,4 @@ FText UPlayerStatsWidget::FormatStatText(float CurrentValue, float MaxValue, con
             MaxValue
         )
     );
-}
\ No newline at end of file
+}
@@ -0,0 +1,63 @@
+#include "ResourceDefinition.h"
+
+void UResourceDefinition::PostLoad()
+{
+    Super::PostLoad();
+
+    CacheThresholds();
+}
+
+#if WITH_EDITOR
+void UResourceDefinition::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    CacheThresholds();
+}
+#endif
+
+void UResourceDefinition::CacheThresholds()
+{
+    StateThresholds.Reset(States.Num());
+    bThresholdsDescending = true;
+
+    for (int32 i = 0; i < States.Num(); ++i)
+    {
+        StateThresholds.Add(States[i].ResourceAmount);
+        bThresholdsDescending &= i == 0 || StateThresholds[i] < StateThresholds[i - 1];
+    }
+}
+
+int32 UResourceDefinition::FindStateForAmount(int32 Remaining) const
+{
+    // Assets created at runtime never went through PostLoad, and unordered tables need the full scan
+    if (!bThresholdsDescending || StateThresholds.Num() != States.Num())
+    {
+        return AMineableResource::FindStateForAmount(States, Remaining);
+    }
+
+    // The states still holding the amount form a prefix, find its last one
+    int32 Low = 0;
+    int32 High = StateThresholds.Num();
+    while (Low < High)
+    {
+        const int32 Mid = (Low + High) / 2;
+        if (Remaining <= StateThresholds[Mid])
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+    return Low - 1;
+}
+
+int32 UResourceDefinition::GetChunkAmount(int32 StateIndex, int32 Remaining) const
+{
+    if (Remaining <= 0 || !States.IsValidIndex(StateIndex + 1)) return 0;
+
+    // Mining a chunk takes the amount down to the next state
+    return Remaining - States[StateIndex + 1].ResourceAmount;
+}
@@ -0,0 +1,313 @@
+#include "ResourceField.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "InteractableIndexSubsystem.h"
+#include "ResourceRespawnSubsystem.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
+
+AResourceField::AResourceField()
+{
+    // Nodes only change on interaction, so the field never ticks
+    PrimaryActorTick.bCanEverTick = false;
+
+    RootComp = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
+    RootComponent = RootComp;
+}
+
+void AResourceField::BeginPlay()
+{
+    Super::BeginPlay();
+
+    const TArray<FResourceState>& States = GetStates();
+    if (States.Num() == 0) return;
+
+    const int32 InitialStateIndex = FMath::Clamp(GetResourceDefaults()->GetInitialStateIndex(), 0, States.Num() - 1);
+    const FResourceState& InitialState = States[InitialStateIndex];
+
+    // Build every node in its initial state
+    Nodes.SetNum(NodeTransforms.Num());
+    TArray<FTransform> InstanceTransforms;
+    InstanceTransforms.Reserve(NodeTransforms.Num());
+
+    for (int32 i = 0; i < NodeTransforms.Num(); ++i)
+    {
+        FResourceFieldNode& Node = Nodes[i];
+        Node.Transform = NodeTransforms[i] * GetActorTransform();
+        Node.StateIndex = InitialStateIndex;
+        Node.RemainingResource = InitialState.ResourceAmount;
+        Node.StateMesh = InitialState.ResourceMesh;
+        InstanceTransforms.Add(Node.Transform);
+    }
+
+    // All nodes share the initial state, so the whole field goes into one HISM in a single batch
+    if (InitialState.ResourceMesh)
+    {
+        FResourceFieldBatch& Batch = FindOrAddBatch(InitialState.ResourceMesh);
+        const TArray<int32> InstanceIndices = Batch.Component->AddInstances(InstanceTransforms, true, true);
+
+        Batch.InstanceNodes.SetNum(Batch.Component->GetInstanceCount());
+        for (int32 i = 0; i < InstanceIndices.Num(); ++i)
+        {
+            Nodes[i].InstanceIndex = InstanceIndices[i];
+            Batch.InstanceNodes[InstanceIndices[i]] = i;
+        }
+
+        // Register every node so interaction queries can find it without an actor
+        if (UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>())
+        {
+            const FBoxSphereBounds MeshBounds = InitialState.ResourceMesh->GetBounds();
+            for (int32 i = 0; i < Nodes.Num(); ++i)
+            {
+                const FBoxSphereBounds NodeBounds = MeshBounds.TransformBy(Nodes[i].Transform);
+                Nodes[i].InteractableHandle = InteractableIndex->Register(this, NodeBounds.Origin, NodeBounds.SphereRadius, i);
+            }
+        }
+    }
+}
+
+void AResourceField::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Super::EndPlay(EndPlayReason);
+
+    if (UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>())
+    {
+        for (FResourceFieldNode& Node : Nodes)
+        {
+            InteractableIndex->Unregister(Node.InteractableHandle);
+        }
+    }
+}
+
+const TArray<FResourceState>& AResourceField::GetStates() const
+{
+    static const TArray<FResourceState> NoStates;
+    return ResourceClass ? GetResourceDefaults()->GetResourceStates() : NoStates;
+}
+
+const AMineableResource* AResourceField::GetResourceDefaults() const
+{
+    return ResourceClass ? ResourceClass->GetDefaultObject<AMineableResource>() : nullptr;
+}
+
+EResourceType AResourceField::GetResourceType() const
+{
+    return ResourceClass ? ResourceClass->GetDefaultObject<AMineableResource>()->ResourceType : EResourceType::Wood;
+}
+
+FResourceFieldBatch& AResourceField::FindOrAddBatch(UStaticMesh* Mesh)
+{
+    if (FResourceFieldBatch* Existing = Batches.Find(Mesh))
+    {
+        return *Existing;
+    }
+
+    // Setup the instanced component for this state mesh
+    UHierarchicalInstancedStaticMeshComponent* Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+    Component->SetStaticMesh(Mesh);
+
+    // Match the collision of a standalone resource so traces behave the same
+    if (const UPrimitiveComponent* DefaultRoot = Cast<UPrimitiveComponent>(ResourceClass->GetDefaultObject<AMineableResource>()->GetRootComponent()))
+    {
+        Component->SetCollisionProfileName(DefaultRoot->GetCollisionProfileName());
+    }
+
+    Component->SetupAttachment(RootComp);
+    Component->RegisterComponent();
+    AddInstanceComponent(Component);
+
+    FResourceFieldBatch& Batch = Batches.Add(Mesh);
+    Batch.Component = Component;
+    return Batch;
+}
+
+void AResourceField::AddNodeInstance(int32 NodeIndex)
+{
+    FResourceFieldNode& Node = Nodes[NodeIndex];
+    Node.StateMesh = GetStates()[Node.StateIndex].ResourceMesh;
+    Node.InstanceIndex = INDEX_NONE;
+
+    // Depleted states without a mesh are simply not drawn
+    if (!Node.StateMesh) return;
+
+    FResourceFieldBatch& Batch = FindOrAddBatch(Node.StateMesh);
+    Node.InstanceIndex = Batch.Component->AddInstance(Node.Transform, true);
+
+    if (Batch.InstanceNodes.Num() <= Node.InstanceIndex)
+    {
+        Batch.InstanceNodes.SetNum(Node.InstanceIndex + 1);
+    }
+    Batch.InstanceNodes[Node.InstanceIndex] = NodeIndex;
+}
+
+void AResourceField::RemoveNodeInstance(int32 NodeIndex)
+{
+    FResourceFieldNode& Node = Nodes[NodeIndex];
+    FResourceFieldBatch* Batch = Node.StateMesh ? Batches.Find(Node.StateMesh) : nullptr;
+
+    if (Batch && Node.InstanceIndex != INDEX_NONE)
+    {
+        // HISMs remove with RemoveAtSwap, so the last instance takes over the freed index
+        Batch->Component->RemoveInstance(Node.InstanceIndex);
+
+        const int32 LastIndex = Batch->InstanceNodes.Num() - 1;
+        if (Node.InstanceIndex != LastIndex)
+        {
+            Nodes[Batch->InstanceNodes[LastIndex]].InstanceIndex = Node.InstanceIndex;
+        }
+        Batch->InstanceNodes.RemoveAtSwap(Node.InstanceIndex, 1, EAllowShrinking::No);
+    }
+
+    Node.InstanceIndex = INDEX_NONE;
+    Node.StateMesh = nullptr;
+}
+
+void AResourceField::SetNodeState(int32 NodeIndex, int32 NewStateIndex)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalResourceState);
+    SURVIVAL_DEBUG_TIMER(ResourceState);
+
+    FResourceFieldNode& Node = Nodes[NodeIndex];
+    if (Node.StateIndex == NewStateIndex) return;
+
+    INC_DWORD_STAT(STAT_SurvivalResourceStateSwaps);
+
+    // Entering a state resets the amount to that state's value, like AMineableResource::UpdateMeshState
+    const FResourceState& NewState = GetStates()[NewStateIndex];
+    Node.StateIndex = NewStateIndex;
+    Node.RemainingResource = NewState.ResourceAmount;
+
+    // Only move the instance when the mesh actually changes
+    if (NewState.ResourceMesh != Node.StateMesh)
+    {
+        RemoveNodeInstance(NodeIndex);
+        AddNodeInstance(NodeIndex);
+    }
+}
+
+int32 AResourceField::MineNode(int32 NodeIndex, int32 AmountToMine)
+{
+    if (!Nodes.IsValidIndex(NodeIndex)) return 0;
+
+    // Promoted nodes are owned by their actor
+    FResourceFieldNode& Node = Nodes[NodeIndex];
+    if (AMineableResource* Promoted = Node.PromotedActor.Get())
+    {
+        return Promoted->Mine(AmountToMine);
+    }
+
+    if (Node.RemainingResource <= 0) return 0;
+
+    // Ensure we don't mine more than what's available
+    const int32 ActualMined = FMath::Min(AmountToMine, Node.RemainingResource);
+    Node.RemainingResource -= ActualMined;
+
+    const int32 NewStateIndex = GetResourceDefaults()->FindStateIndex(Node.RemainingResource);
+    if (NewStateIndex != INDEX_NONE)
+    {
+        SetNodeState(NodeIndex, NewStateIndex);
+    }
+
+    // Nodes respawn like the resource actors they stand in for
+    const float RespawnSeconds = GetResourceDefaults()->GetRespawnSeconds();
+    if (Node.RemainingResource <= 0 && RespawnSeconds > 0.0f && UResourceRespawnSubsystem::IsEnabled())
+    {
+        if (UResourceRespawnSubsystem* ResourceRespawn = GetWorld()->GetSubsystem<UResourceRespawnSubsystem>())
+        {
+            ResourceRespawn->ScheduleRespawn(this, NodeIndex, RespawnSeconds);
+        }
+    }
+    return ActualMined;
+}
+
+void AResourceField::RespawnNode(int32 NodeIndex)
+{
+    if (!Nodes.IsValidIndex(NodeIndex)) return;
+
+    // A node promoted while depleted was scheduled before its actor existed, so restore the actor
+    if (AMineableResource* Promoted = Nodes[NodeIndex].PromotedActor.Get())
+    {
+        Promoted->Respawn();
+        return;
+    }
+
+    const int32 InitialStateIndex = GetResourceDefaults()->GetInitialStateIndex();
+    if (GetStates().IsValidIndex(InitialStateIndex))
+    {
+        SetNodeState(NodeIndex, InitialStateIndex);
+    }
+}
+
+int32 AResourceField::GetNodeChunkAmount(int32 NodeIndex) const
+{
+    if (!Nodes.IsValidIndex(NodeIndex)) return 0;
+
+    const FResourceFieldNode& Node = Nodes[NodeIndex];
+    if (const AMineableResource* Promoted = Node.PromotedActor.Get())
+    {
+        return Promoted->GetCurrentChunkAmount();
+    }
+
+    const AMineableResource* Defaults = GetResourceDefaults();
+    return Defaults ? Defaults->GetChunkAmount(Node.StateIndex, Node.RemainingResource) : 0;
+}
+
+AMineableResource* AResourceField::PromoteNode(int32 NodeIndex)
+{
+    if (!Nodes.IsValidIndex(NodeIndex) || !ResourceClass) return nullptr;
+
+    FResourceFieldNode& Node = Nodes[NodeIndex];
+    if (AMineableResource* Promoted = Node.PromotedActor.Get())
+    {
+        return Promoted;
+    }
+
+    // Spawn the full actor first so the node never disappears if spawning fails
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    AMineableResource* Resource = GetWorld()->SpawnActor<AMineableResource>(ResourceClass, Node.Transform, SpawnParams);
+    if (!Resource) return nullptr;
+
+    Resource->RestoreState(Node.StateIndex, Node.RemainingResource);
+    RemoveNodeInstance(NodeIndex);
+    Node.PromotedActor = Resource;
+
+    // The promoted actor registers itself, so the node entry is no longer needed
+    if (UInteractableIndexSubsystem* InteractableIndex = GetWorld()->GetSubsystem<UInteractableIndexSubsystem>())
+    {
+        InteractableIndex->Unregister(Node.InteractableHandle);
+    }
+    return Resource;
+}
+
+int32 AResourceField::FindNodeForInstance(const UPrimitiveComponent* Component, int32 InstanceIndex) const
+{
+    for (const TPair<TObjectPtr<UStaticMesh>, FResourceFieldBatch>& Pair : Batches)
+    {
+        if (Pair.Value.Component == Component)
+        {
+            return Pair.Value.InstanceNodes.IsValidIndex(InstanceIndex) ? Pair.Value.InstanceNodes[InstanceIndex] : INDEX_NONE;
+        }
+    }
+    return INDEX_NONE;
+}
+
+FInteractionResult AResourceField::GetInteraction(int32 Item) const
+{
+    FInteractionResult Result;
+    Result.ResourceType = GetResourceType();
+    Result.Amount = GetNodeChunkAmount(Item);
+    Result.StaminaCost = Result.Amount * (ResourceClass ? ResourceClass->GetDefaultObject<AMineableResource>()->StaminaCostPerUnit : 0.0f);
+    return Result;
+}
+
+FInteractionResult AResourceField::Interact(AActor* Instigator, int32 Item)
+{
+    // Interacting promotes the node so it behaves exactly like a placed resource from now on
+    AMineableResource* Resource = PromoteNode(Item);
+    return Resource ? Resource->Interact(Instigator, INDEX_NONE) : FInteractionResult();
+}
+
+int32 AResourceField::GetItemForHit(const FHitResult& Hit) const
+{
+    return FindNodeForInstance(Hit.GetComponent(), Hit.Item);
+}
\ No newline at end of file
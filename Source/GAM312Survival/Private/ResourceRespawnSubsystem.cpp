@@ -0,0 +1,79 @@
+#include "ResourceRespawnSubsystem.h"
+#include "MineableResource.h"
+#include "ResourceField.h"
+#include "HAL/IConsoleManager.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
+
+namespace ResourceRespawn
+{
+    bool bEnabled = true;
+    FAutoConsoleVariableRef CVarEnabled(
+        TEXT("survival.Resources.Respawn"),
+        bEnabled,
+        TEXT("Restore depleted mineable resources after their respawn delay."),
+        ECVF_Default
+    );
+}
+
+bool UResourceRespawnSubsystem::IsEnabled()
+{
+    return ResourceRespawn::bEnabled;
+}
+
+void UResourceRespawnSubsystem::Deinitialize()
+{
+    DEC_DWORD_STAT_BY(STAT_SurvivalPendingRespawns, Wheel.Num());
+
+    Super::Deinitialize();
+}
+
+void UResourceRespawnSubsystem::ScheduleRespawn(AMineableResource* Resource, float DelaySeconds)
+{
+    if (Resource)
+    {
+        FPendingResourceRespawn Pending;
+        Pending.Resource = Resource;
+        Wheel.Schedule(Pending, DelaySeconds);
+        INC_DWORD_STAT(STAT_SurvivalPendingRespawns);
+    }
+}
+
+void UResourceRespawnSubsystem::ScheduleRespawn(AResourceField* Field, int32 NodeIndex, float DelaySeconds)
+{
+    if (Field)
+    {
+        FPendingResourceRespawn Pending;
+        Pending.Field = Field;
+        Pending.NodeIndex = NodeIndex;
+        Wheel.Schedule(Pending, DelaySeconds);
+        INC_DWORD_STAT(STAT_SurvivalPendingRespawns);
+    }
+}
+
+void UResourceRespawnSubsystem::Tick(float DeltaTime)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalResourceRespawn);
+    SURVIVAL_DEBUG_TIMER(ResourceState);
+
+    Super::Tick(DeltaTime);
+
+    // Resources destroyed while waiting are simply dropped
+    const int32 NumDue = Wheel.Advance(DeltaTime, [](const FPendingResourceRespawn& Pending)
+    {
+        if (AMineableResource* Resource = Pending.Resource.Get())
+        {
+            Resource->Respawn();
+        }
+        else if (AResourceField* Field = Pending.Field.Get())
+        {
+            Field->RespawnNode(Pending.NodeIndex);
+        }
+    });
+    DEC_DWORD_STAT_BY(STAT_SurvivalPendingRespawns, NumDue);
+}
+
+TStatId UResourceRespawnSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UResourceRespawnSubsystem, STATGROUP_Tickables);
+}
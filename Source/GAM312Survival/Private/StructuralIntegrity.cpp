@@ -0,0 +1,152 @@
+#include "StructuralIntegrity.h"
+
+FStructuralIntegrityGraph::FStructuralIntegrityGraph(const FStructuralIntegritySettings& InSettings)
+    : Settings(InSettings)
+{
+}
+
+int32 FStructuralIntegrityGraph::GetLoss(const FStructureSlot& Slot) const
+{
+    switch (Slot.Face)
+    {
+    case EStructureSlotFace::WallX:
+    case EStructureSlotFace::WallY: return Settings.WallLoss;
+    case EStructureSlotFace::Slant: return Settings.SlantLoss;
+    default:                        return Settings.FloorLoss;
+    }
+}
+
+int32 FStructuralIntegrityGraph::GetPlacementStability(const FStructureSlot& Slot, bool bGrounded) const
+{
+    if (bGrounded) return Settings.MaxStability;
+
+    FStructureSlotList Supports;
+    FStructureGrid::GetSupportSlots(Slot, Supports);
+
+    int32 Best = 0;
+    for (const FStructureSlot& Support : Supports)
+    {
+        if (const FNode* Node = Nodes.Find(Support))
+        {
+            Best = FMath::Max(Best, Node->Stability);
+        }
+    }
+    return FMath::Max(Best - GetLoss(Slot), 0);
+}
+
+int32 FStructuralIntegrityGraph::Add(const FStructureSlot& Slot, bool bGrounded)
+{
+    NumVisited = 0;
+
+    FNode& Node = Nodes.FindOrAdd(Slot);
+    Node.bGrounded = bGrounded;
+    Node.Stability = 0;
+    Node.Stability = GetPlacementStability(Slot, bGrounded);
+    const int32 Stability = Node.Stability;
+
+    RaiseQueue.Reset();
+    RaiseQueue.Add(Slot);
+    PropagateRaise();
+    return Stability;
+}
+
+void FStructuralIntegrityGraph::Remove(const FStructureSlot& Slot, TArray<FStructureSlot>& OutCollapsed)
+{
+    NumVisited = 0;
+
+    FNode Removed;
+    if (!Nodes.RemoveAndCopyValue(Slot, Removed)) return;
+
+    ClearQueue.Reset();
+    RaiseQueue.Reset();
+    Cleared.Reset();
+    ClearQueue.Emplace(Slot, Removed.Stability);
+
+    // Clear every part whose best support ran through a cleared one; parts with a
+    // better path keep theirs and refill the cleared ones afterwards
+    FStructureSlotList Neighbours;
+    for (int32 i = 0; i < ClearQueue.Num(); ++i)
+    {
+        const FStructureSlot Current = ClearQueue[i].Key;
+        const int32 OldStability = ClearQueue[i].Value;
+
+        Neighbours.Reset();
+        FStructureGrid::GetSupportedSlots(Current, Neighbours);
+        for (const FStructureSlot& Neighbour : Neighbours)
+        {
+            FNode* Node = Nodes.Find(Neighbour);
+            if (!Node || Node->bGrounded || Node->Stability <= 0) continue;
+
+            if (Node->Stability == OldStability - GetLoss(Neighbour))
+            {
+                ClearQueue.Emplace(Neighbour, Node->Stability);
+                Cleared.Add(Neighbour);
+                Node->Stability = 0;
+            }
+        }
+    }
+
+    // Refill from the supports around the cleared parts that kept their stability
+    for (const FStructureSlot& Current : Cleared)
+    {
+        Neighbours.Reset();
+        FStructureGrid::GetSupportSlots(Current, Neighbours);
+        for (const FStructureSlot& Support : Neighbours)
+        {
+            const FNode* Node = Nodes.Find(Support);
+            if (Node && Node->Stability > 0)
+            {
+                RaiseQueue.Add(Support);
+            }
+        }
+    }
+    const int32 NumCleared = ClearQueue.Num();
+    PropagateRaise();
+    NumVisited += NumCleared;
+
+    // Whatever could not be refilled has nothing holding it up
+    for (const FStructureSlot& Current : Cleared)
+    {
+        const FNode* Node = Nodes.Find(Current);
+        if (Node && Node->Stability <= 0)
+        {
+            OutCollapsed.Add(Current);
+        }
+    }
+    for (const FStructureSlot& Collapsed : OutCollapsed)
+    {
+        Nodes.Remove(Collapsed);
+    }
+}
+
+int32 FStructuralIntegrityGraph::GetStability(const FStructureSlot& Slot) const
+{
+    const FNode* Node = Nodes.Find(Slot);
+    return Node ? Node->Stability : 0;
+}
+
+void FStructuralIntegrityGraph::PropagateRaise()
+{
+    FStructureSlotList Neighbours;
+    for (int32 i = 0; i < RaiseQueue.Num(); ++i)
+    {
+        const FStructureSlot Current = RaiseQueue[i];
+        const int32 Stability = Nodes.FindChecked(Current).Stability;
+
+        Neighbours.Reset();
+        FStructureGrid::GetSupportedSlots(Current, Neighbours);
+        for (const FStructureSlot& Neighbour : Neighbours)
+        {
+            FNode* Node = Nodes.Find(Neighbour);
+            if (!Node || Node->bGrounded) continue;
+
+            const int32 Candidate = Stability - GetLoss(Neighbour);
+            if (Candidate > Node->Stability)
+            {
+                Node->Stability = Candidate;
+                RaiseQueue.Add(Neighbour);
+            }
+        }
+    }
+    NumVisited += RaiseQueue.Num();
+}
@@ -0,0 +1,256 @@
+#include "StructureCompactionSubsystem.h"
+#include "BuildablePoolSubsystem.h"
+#include "StructureGridSubsystem.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "HAL/IConsoleManager.h"
+#include "GAM312Survival.h"
+
+namespace StructureCompaction
+{
+    bool bEnabled = true;
+    FAutoConsoleVariableRef CVarEnabled(
+        TEXT("survival.Structures.Compaction"),
+        bEnabled,
+        TEXT("Fold placed structures into per-cell instanced meshes once their placement animation finished."),
+        ECVF_Default
+    );
+
+    float CellSize = 2000.0f;
+    FAutoConsoleVariableRef CVarCellSize(
+        TEXT("survival.Structures.CellSize"),
+        CellSize,
+        TEXT("Size of the grid cells compacted structures are batched by."),
+        ECVF_ReadOnly
+    );
+}
+
+bool UStructureCompactionSubsystem::IsEnabled()
+{
+    return StructureCompaction::bEnabled;
+}
+
+FIntPoint UStructureCompactionSubsystem::GetCell(const FVector& Location)
+{
+    return FIntPoint(
+        FMath::FloorToInt(Location.X / StructureCompaction::CellSize),
+        FMath::FloorToInt(Location.Y / StructureCompaction::CellSize)
+    );
+}
+
+int32 UStructureCompactionSubsystem::Compact(ABuildableBase* Buildable)
+{
+    UBuildablePoolSubsystem* BuildablePool = GetWorld()->GetSubsystem<UBuildablePoolSubsystem>();
+    UStaticMesh* Mesh = Buildable ? Buildable->BuildableMesh->GetStaticMesh() : nullptr;
+    if (!Mesh || !BuildablePool) return INDEX_NONE;
+
+    FStructureRecord Record;
+    Record.Class = Buildable->GetClass();
+    Record.BuildableType = Buildable->BuildableType;
+    Record.MaterialType = Buildable->MaterialType;
+    Record.Transform = Buildable->GetActorTransform();
+    Record.Health = Buildable->Health;
+    Record.Mesh = Mesh;
+    Record.OverrideMaterials = ToRawPtrTArrayUnsafe(Buildable->BuildableMesh->OverrideMaterials);
+    Record.Cell = GetCell(Record.Transform.GetLocation());
+    Record.GridSlot = Buildable->GridSlot;
+    Record.bOccupiesGridSlot = Buildable->bOccupiesGridSlot;
+
+    Record.Batch = FindOrAddBatch(Record.Cell, Buildable->BuildableMesh);
+    FStructureBatch& Batch = Batches[Record.Batch];
+    Record.InstanceIndex = Batch.Component->AddInstance(Record.Transform, true);
+
+    const int32 Handle = Records.Add(Record);
+    if (Batch.InstanceRecords.Num() <= Record.InstanceIndex)
+    {
+        Batch.InstanceRecords.SetNum(Record.InstanceIndex + 1);
+    }
+    Batch.InstanceRecords[Record.InstanceIndex] = Handle;
+
+    // The instance takes over drawing, collision and the grid socket, the actor goes back to the pool
+    UStructureGridSubsystem* StructureGrid = GetWorld()->GetSubsystem<UStructureGridSubsystem>();
+    if (Record.bOccupiesGridSlot && StructureGrid)
+    {
+        StructureGrid->SetOccupant(Record.GridSlot, nullptr, Handle);
+    }
+    Buildable->bOccupiesGridSlot = false;
+    BuildablePool->Release(Buildable);
+    INC_DWORD_STAT(STAT_SurvivalCompactedStructures);
+    return Handle;
+}
+
+ABuildableBase* UStructureCompactionSubsystem::Uncompact(int32 Handle)
+{
+    UBuildablePoolSubsystem* BuildablePool = GetWorld()->GetSubsystem<UBuildablePoolSubsystem>();
+    if (!Records.IsValidIndex(Handle) || !BuildablePool) return nullptr;
+
+    const FStructureRecord Record = Records[Handle];
+
+    // HISMs remove with RemoveAtSwap, so the last instance takes over the freed index
+    FStructureBatch& Batch = Batches[Record.Batch];
+    Batch.Component->RemoveInstance(Record.InstanceIndex);
+
+    const int32 LastIndex = Batch.InstanceRecords.Num() - 1;
+    if (Record.InstanceIndex != LastIndex)
+    {
+        Records[Batch.InstanceRecords[LastIndex]].InstanceIndex = Record.InstanceIndex;
+    }
+    Batch.InstanceRecords.RemoveAtSwap(Record.InstanceIndex, 1, EAllowShrinking::No);
+    Records.RemoveAt(Handle);
+    DEC_DWORD_STAT(STAT_SurvivalCompactedStructures);
+
+    // The instance is gone, so nothing blocks the actor at its own transform
+    ABuildableBase* Buildable = BuildablePool->Acquire(Record.Class, Record.Transform, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    if (Buildable)
+    {
+        Buildable->MaterialType = Record.MaterialType;
+        Buildable->BuildableType = Record.BuildableType;
+        Buildable->Health = Record.Health;
+        Buildable->BuildableMesh->SetStaticMesh(Record.Mesh);
+        Buildable->BuildableMesh->EmptyOverrideMaterials();
+        for (int32 i = 0; i < Record.OverrideMaterials.Num(); ++i)
+        {
+            Buildable->BuildableMesh->SetMaterial(i, Record.OverrideMaterials[i]);
+        }
+        Buildable->GridSlot = Record.GridSlot;
+        Buildable->bOccupiesGridSlot = Record.bOccupiesGridSlot;
+        Buildable->bPlaced = true;
+
+        UStructureGridSubsystem* StructureGrid = GetWorld()->GetSubsystem<UStructureGridSubsystem>();
+        if (Record.bOccupiesGridSlot && StructureGrid)
+        {
+            StructureGrid->SetOccupant(Record.GridSlot, Buildable);
+        }
+    }
+    return Buildable;
+}
+
+void UStructureCompactionSubsystem::RemoveRecords(const TArray<int32>& Handles)
+{
+    // Group the instances by batch, so each batch removes its instances in one go
+    TMap<int32, TArray<int32>> InstancesByBatch;
+    for (const int32 Handle : Handles)
+    {
+        if (!Records.IsValidIndex(Handle)) continue;
+
+        const FStructureRecord& Record = Records[Handle];
+        InstancesByBatch.FindOrAdd(Record.Batch).Add(Record.InstanceIndex);
+        Records.RemoveAt(Handle);
+        DEC_DWORD_STAT(STAT_SurvivalCompactedStructures);
+    }
+
+    for (TPair<int32, TArray<int32>>& Pair : InstancesByBatch)
+    {
+        FStructureBatch& Batch = Batches[Pair.Key];
+        TArray<int32>& Instances = Pair.Value;
+
+        // Removing from the back means the instance swapped into a freed index is never one still to be removed
+        Instances.Sort(TGreater<int32>());
+        for (const int32 InstanceIndex : Instances)
+        {
+            const int32 LastIndex = Batch.InstanceRecords.Num() - 1;
+            if (InstanceIndex != LastIndex)
+            {
+                Records[Batch.InstanceRecords[LastIndex]].InstanceIndex = InstanceIndex;
+            }
+            Batch.InstanceRecords.RemoveAtSwap(InstanceIndex, 1, EAllowShrinking::No);
+        }
+        Batch.Component->RemoveInstances(Instances);
+    }
+}
+
+const FStructureRecord* UStructureCompactionSubsystem::GetRecord(int32 Handle) const
+{
+    return Records.IsValidIndex(Handle) ? &Records[Handle] : nullptr;
+}
+
+void UStructureCompactionSubsystem::SetRecordHealth(int32 Handle, float Health)
+{
+    if (Records.IsValidIndex(Handle))
+    {
+        Records[Handle].Health = Health;
+    }
+}
+
+int32 UStructureCompactionSubsystem::FindRecordForInstance(const UPrimitiveComponent* Component, int32 InstanceIndex) const
+{
+    const int32* BatchIndex = ComponentBatches.Find(Component);
+    const FStructureBatch* Batch = BatchIndex ? &Batches[*BatchIndex] : nullptr;
+    return Batch && Batch->InstanceRecords.IsValidIndex(InstanceIndex) ? Batch->InstanceRecords[InstanceIndex] : INDEX_NONE;
+}
+
+void UStructureCompactionSubsystem::FindRecordsInRadius(const FVector& Center, float Radius, TArray<int32>& OutHandles) const
+{
+    const FIntPoint MinCell = GetCell(Center - FVector(Radius));
+    const FIntPoint MaxCell = GetCell(Center + FVector(Radius));
+    const float RadiusSquared = FMath::Square(Radius);
+
+    // Only the batches of cells touching the radius are visited
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            const TArray<int32, TInlineAllocator<4>>* BatchIndices = CellBatches.Find(FIntPoint(X, Y));
+            if (!BatchIndices) continue;
+
+            for (const int32 BatchIndex : *BatchIndices)
+            {
+                for (const int32 Handle : Batches[BatchIndex].InstanceRecords)
+                {
+                    if (FVector::DistSquared(Records[Handle].Transform.GetLocation(), Center) <= RadiusSquared)
+                    {
+                        OutHandles.Add(Handle);
+                    }
+                }
+            }
+        }
+    }
+}
+
+int32 UStructureCompactionSubsystem::FindOrAddBatch(const FIntPoint& Cell, const UStaticMeshComponent* Template)
+{
+    FStructureBatchKey Key;
+    Key.Cell = Cell;
+    Key.Mesh = Template->GetStaticMesh();
+    Key.Materials = ToRawPtrTArrayUnsafe(Template->OverrideMaterials);
+    if (const int32* Existing = BatchIndices.Find(Key))
+    {
+        return *Existing;
+    }
+
+    // Each cell gets its own owner, so whole cells can be culled and streamed together
+    TObjectPtr<AActor>& CellOwner = CellOwners.FindOrAdd(Cell);
+    if (!CellOwner)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        CellOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+
+        USceneComponent* Root = NewObject<USceneComponent>(CellOwner, TEXT("Root"));
+        CellOwner->SetRootComponent(Root);
+        Root->RegisterComponent();
+    }
+
+    // Match the look and collision of a standalone structure, including responses changed
+    // on its instance, so traces and movement behave the same
+    UHierarchicalInstancedStaticMeshComponent* Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(CellOwner);
+    Component->SetStaticMesh(Key.Mesh);
+    for (int32 i = 0; i < Key.Materials.Num(); ++i)
+    {
+        Component->SetMaterial(i, Key.Materials[i]);
+    }
+    Component->SetCollisionProfileName(Template->GetCollisionProfileName());
+    Component->SetCollisionEnabled(Template->GetCollisionEnabled());
+    Component->SetCollisionObjectType(Template->GetCollisionObjectType());
+    Component->SetCollisionResponseToChannels(Template->GetCollisionResponseToChannels());
+    Component->SetupAttachment(CellOwner->GetRootComponent());
+    Component->RegisterComponent();
+    CellOwner->AddInstanceComponent(Component);
+
+    const int32 BatchIndex = Batches.AddDefaulted();
+    Batches[BatchIndex].Component = Component;
+    BatchIndices.Add(MoveTemp(Key), BatchIndex);
+    ComponentBatches.Add(Component, BatchIndex);
+    CellBatches.FindOrAdd(Cell).Add(BatchIndex);
+    return BatchIndex;
+}
@@ -0,0 +1,167 @@
+#include "StructureGrid.h"
+#include "BuildableBase.h"
+
+namespace StructureGrid
+{
+    /* Aimed points slightly below a level still count as that level, e.g. the top of a floor */
+    constexpr float LevelBias = 0.1f;
+
+    const FIntVector X(1, 0, 0);
+    const FIntVector Y(0, 1, 0);
+    const FIntVector Z(0, 0, 1);
+}
+
+FStructureGrid::FStructureGrid(float InCellSize)
+    : CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+FStructureSlot FStructureGrid::FindSnapSlot(EBuildableType Type, const FVector& Location) const
+{
+    const FVector GridLocation = Location / CellSize;
+    const FIntVector Cell(
+        FMath::FloorToInt(GridLocation.X),
+        FMath::FloorToInt(GridLocation.Y),
+        FMath::FloorToInt(GridLocation.Z + StructureGrid::LevelBias)
+    );
+
+    switch (Type)
+    {
+    case EBuildableType::Wall:
+    {
+        // Nearest of the four vertical faces, stored on the -X or -Y side of a cell
+        const float FromMinX = GridLocation.X - Cell.X;
+        const float FromMinY = GridLocation.Y - Cell.Y;
+        const float Distances[] = { FromMinX, 1.0f - FromMinX, FromMinY, 1.0f - FromMinY };
+
+        int32 Nearest = 0;
+        for (int32 i = 1; i < UE_ARRAY_COUNT(Distances); ++i)
+        {
+            if (Distances[i] < Distances[Nearest]) Nearest = i;
+        }
+
+        switch (Nearest)
+        {
+        case 0:  return FStructureSlot(Cell, EStructureSlotFace::WallX);
+        case 1:  return FStructureSlot(Cell + StructureGrid::X, EStructureSlotFace::WallX);
+        case 2:  return FStructureSlot(Cell, EStructureSlotFace::WallY);
+        default: return FStructureSlot(Cell + StructureGrid::Y, EStructureSlotFace::WallY);
+        }
+    }
+    case EBuildableType::Slant:
+        return FStructureSlot(Cell, EStructureSlotFace::Slant);
+    default:
+        return FStructureSlot(Cell, EStructureSlotFace::Floor);
+    }
+}
+
+FTransform FStructureGrid::GetSlotTransform(const FStructureSlot& Slot, float Yaw) const
+{
+    const FVector Corner = FVector(Slot.Cell) * CellSize;
+    const float Half = CellSize * 0.5f;
+
+    switch (Slot.Face)
+    {
+    case EStructureSlotFace::WallX:
+        return FTransform(FRotator(0.0f, 90.0f, 0.0f), Corner + FVector(0.0f, Half, 0.0f));
+    case EStructureSlotFace::WallY:
+        return FTransform(FRotator::ZeroRotator, Corner + FVector(Half, 0.0f, 0.0f));
+    default:
+        return FTransform(FRotator(0.0f, FMath::GridSnap(Yaw, 90.0f), 0.0f), Corner + FVector(Half, Half, 0.0f));
+    }
+}
+
+bool FStructureGrid::IsOnFloorLevel(const FStructureSlot& Slot, const FVector& Location) const
+{
+    // Same tolerance snapping uses to assign aimed points to a level
+    return FMath::Abs(Location.Z / CellSize - Slot.Cell.Z) <= StructureGrid::LevelBias;
+}
+
+bool FStructureGrid::IsSupported(const FStructureSlot& Slot, bool bGrounded) const
+{
+    if (bGrounded) return true;
+
+    FStructureSlotList Supports;
+    GetSupportSlots(Slot, Supports);
+    for (const FStructureSlot& Support : Supports)
+    {
+        if (Occupied.Contains(Support)) return true;
+    }
+    return false;
+}
+
+void FStructureGrid::GetSupportSlots(const FStructureSlot& Slot, FStructureSlotList& OutSlots)
+{
+    const FIntVector& C = Slot.Cell;
+    using namespace StructureGrid;
+
+    switch (Slot.Face)
+    {
+    case EStructureSlotFace::WallX:
+        OutSlots.Add(FStructureSlot(C, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - X, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - Z, EStructureSlotFace::WallX));
+        break;
+    case EStructureSlotFace::WallY:
+        OutSlots.Add(FStructureSlot(C, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - Y, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - Z, EStructureSlotFace::WallY));
+        break;
+    default:
+        // Floors and slants rest on the walls around the cell below or reach over from a neighbouring floor
+        OutSlots.Add(FStructureSlot(C - Z, EStructureSlotFace::WallX));
+        OutSlots.Add(FStructureSlot(C + X - Z, EStructureSlotFace::WallX));
+        OutSlots.Add(FStructureSlot(C - Z, EStructureSlotFace::WallY));
+        OutSlots.Add(FStructureSlot(C + Y - Z, EStructureSlotFace::WallY));
+        OutSlots.Add(FStructureSlot(C - Z, EStructureSlotFace::Slant));
+        OutSlots.Add(FStructureSlot(C + X, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - X, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C + Y, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - Y, EStructureSlotFace::Floor));
+        if (Slot.Face == EStructureSlotFace::Slant)
+        {
+            OutSlots.Add(FStructureSlot(C, EStructureSlotFace::Floor));
+        }
+        break;
+    }
+}
+
+void FStructureGrid::GetSupportedSlots(const FStructureSlot& Slot, FStructureSlotList& OutSlots)
+{
+    const FIntVector& C = Slot.Cell;
+    using namespace StructureGrid;
+
+    switch (Slot.Face)
+    {
+    case EStructureSlotFace::Floor:
+        OutSlots.Add(FStructureSlot(C, EStructureSlotFace::WallX));
+        OutSlots.Add(FStructureSlot(C + X, EStructureSlotFace::WallX));
+        OutSlots.Add(FStructureSlot(C, EStructureSlotFace::WallY));
+        OutSlots.Add(FStructureSlot(C + Y, EStructureSlotFace::WallY));
+        OutSlots.Add(FStructureSlot(C, EStructureSlotFace::Slant));
+        for (const FIntVector& Offset : { X, FIntVector(-1, 0, 0), Y, FIntVector(0, -1, 0) })
+        {
+            OutSlots.Add(FStructureSlot(C + Offset, EStructureSlotFace::Floor));
+            OutSlots.Add(FStructureSlot(C + Offset, EStructureSlotFace::Slant));
+        }
+        break;
+    case EStructureSlotFace::WallX:
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::WallX));
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - X + Z, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::Slant));
+        OutSlots.Add(FStructureSlot(C - X + Z, EStructureSlotFace::Slant));
+        break;
+    case EStructureSlotFace::WallY:
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::WallY));
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C - Y + Z, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::Slant));
+        OutSlots.Add(FStructureSlot(C - Y + Z, EStructureSlotFace::Slant));
+        break;
+    case EStructureSlotFace::Slant:
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::Floor));
+        OutSlots.Add(FStructureSlot(C + Z, EStructureSlotFace::Slant));
+        break;
+    }
+}
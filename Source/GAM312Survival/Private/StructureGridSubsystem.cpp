@@ -0,0 +1,147 @@
+#include "StructureGridSubsystem.h"
+#include "BuildableBase.h"
+#include "StructureCompactionSubsystem.h"
+#include "BuildablePoolSubsystem.h"
+#include "Interactable.h"
+#include "Components/PrimitiveComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "GAM312Survival.h"
+
+namespace StructureGrid
+{
+    bool bEnabled = true;
+    FAutoConsoleVariableRef CVarEnabled(
+        TEXT("survival.Structures.Snapping"),
+        bEnabled,
+        TEXT("Snap build previews to the structure grid and validate them against it."),
+        ECVF_Default
+    );
+
+    float GridSize = 400.0f;
+    FAutoConsoleVariableRef CVarGridSize(
+        TEXT("survival.Structures.GridSize"),
+        GridSize,
+        TEXT("Edge length of a structure grid cell, the size of a floor and the height of a wall."),
+        ECVF_ReadOnly
+    );
+
+    /* Steepest ground parts rest on, the character movement default of about 45 degrees */
+    constexpr float WalkableFloorZ = 0.71f;
+}
+
+UStructureGridSubsystem::UStructureGridSubsystem()
+    : Grid(StructureGrid::GridSize)
+{
+}
+
+void UStructureGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Config may have changed the cell size since the class default was constructed
+    Grid = FStructureGrid(StructureGrid::GridSize);
+}
+
+bool UStructureGridSubsystem::IsEnabled()
+{
+    return StructureGrid::bEnabled;
+}
+
+void UStructureGridSubsystem::Occupy(const FStructureSlot& Slot, bool bGrounded, ABuildableBase* Occupant)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalStructuralIntegrity);
+    if (Grid.IsOccupied(Slot)) return;
+
+    Grid.Occupy(Slot);
+    Integrity.Add(Slot, bGrounded);
+    Occupants.Add(Slot).Actor = Occupant;
+    INC_DWORD_STAT(STAT_SurvivalStructureSlots);
+}
+
+void UStructureGridSubsystem::SetOccupant(const FStructureSlot& Slot, ABuildableBase* Actor, int32 Record)
+{
+    if (FStructureOccupant* Occupant = Occupants.Find(Slot))
+    {
+        Occupant->Actor = Actor;
+        Occupant->Record = Record;
+    }
+}
+
+void UStructureGridSubsystem::Vacate(const FStructureSlot& Slot)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalStructuralIntegrity);
+    if (!Grid.IsOccupied(Slot)) return;
+
+    Grid.Vacate(Slot);
+    Occupants.Remove(Slot);
+    DEC_DWORD_STAT(STAT_SurvivalStructureSlots);
+
+    TArray<FStructureSlot> Collapsed;
+    Integrity.Remove(Slot, Collapsed);
+    if (Collapsed.Num() > 0)
+    {
+        Collapse(Collapsed);
+    }
+}
+
+bool UStructureGridSubsystem::IsStructureHit(const FHitResult& Hit) const
+{
+    if (Cast<ABuildableBase>(Hit.GetActor())) return true;
+
+    const UStructureCompactionSubsystem* StructureCompaction = GetWorld()->GetSubsystem<UStructureCompactionSubsystem>();
+    return StructureCompaction && StructureCompaction->FindRecordForInstance(Hit.GetComponent(), Hit.Item) != INDEX_NONE;
+}
+
+bool UStructureGridSubsystem::IsGroundHit(const FHitResult& Hit, const FStructureSlot& Slot) const
+{
+    if (!Hit.bBlockingHit || IsStructureHit(Hit)) return false;
+
+    // Only static world geometry holds parts up, not pickups, resources or anything that moves
+    const UPrimitiveComponent* Component = Hit.GetComponent();
+    if (!Component || Component->GetCollisionObjectType() != ECC_WorldStatic) return false;
+    if (Cast<IInteractable>(Hit.GetActor())) return false;
+
+    const float WalkableZ = Component->GetWalkableSlopeOverride().ModifyWalkableFloorZ(StructureGrid::WalkableFloorZ);
+    return Hit.ImpactNormal.Z >= WalkableZ && Grid.IsOnFloorLevel(Slot, Hit.ImpactPoint);
+}
+
+void UStructureGridSubsystem::Collapse(const TArray<FStructureSlot>& Collapsed)
+{
+    UBuildablePoolSubsystem* BuildablePool = GetWorld()->GetSubsystem<UBuildablePoolSubsystem>();
+    TArray<int32> Records;
+
+    for (const FStructureSlot& Slot : Collapsed)
+    {
+        FStructureOccupant Occupant;
+        Occupants.RemoveAndCopyValue(Slot, Occupant);
+        Grid.Vacate(Slot);
+        DEC_DWORD_STAT(STAT_SurvivalStructureSlots);
+        INC_DWORD_STAT(STAT_SurvivalCollapsedStructures);
+
+        if (Occupant.Record != INDEX_NONE)
+        {
+            Records.Add(Occupant.Record);
+        }
+        else if (ABuildableBase* Actor = Occupant.Actor.Get())
+        {
+            // The graph already dropped the socket, so the actor must not vacate it again
+            Actor->bOccupiesGridSlot = false;
+            if (BuildablePool)
+            {
+                BuildablePool->Release(Actor);
+            }
+            else
+            {
+                Actor->Destroy();
+            }
+        }
+    }
+
+    if (Records.Num() > 0)
+    {
+        if (UStructureCompactionSubsystem* StructureCompaction = GetWorld()->GetSubsystem<UStructureCompactionSubsystem>())
+        {
+            StructureCompaction->RemoveRecords(Records);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include "SurvivalDebugOverlay.h"
+#include "PlayerCharacter.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "CanvasTypes.h"
+
+int32 FSurvivalDebugTimers::NumListeners = 0;
+uint64 FSurvivalDebugTimers::Cycles[FSurvivalDebugTimers::NumTimers] = {};
+uint32 FSurvivalDebugTimers::Calls[FSurvivalDebugTimers::NumTimers] = {};
+
+const TCHAR* FSurvivalDebugTimers::GetName(ESurvivalDebugTimer Timer)
+{
+    switch (Timer)
+    {
+    case ESurvivalDebugTimer::Interaction:   return TEXT("Interaction");
+    case ESurvivalDebugTimer::BuildPreview:  return TEXT("Build Preview");
+    case ESurvivalDebugTimer::SurvivalStats: return TEXT("Survival Stats");
+    case ESurvivalDebugTimer::BerryRegrowth: return TEXT("Berry Regrowth");
+    case ESurvivalDebugTimer::ResourceState: return TEXT("Resource State");
+    case ESurvivalDebugTimer::Butterflies:   return TEXT("Butterflies");
+    default:                                 return TEXT("Unknown");
+    }
+}
+
+FSurvivalDebugOverlay::FSurvivalDebugOverlay(APlayerCharacter* InCharacter, float InRefreshInterval)
+    : Character(InCharacter)
+    , RefreshInterval(FMath::Max(InRefreshInterval, 0.0f))
+{
+    // Reserve once so refreshing never grows the strings
+    for (FString& Line : Lines)
+    {
+        Line.Reserve(128);
+    }
+
+    ++FSurvivalDebugTimers::NumListeners;
+    FMemory::Memcpy(LastCycles, FSurvivalDebugTimers::Cycles, sizeof(LastCycles));
+    FMemory::Memcpy(LastCalls, FSurvivalDebugTimers::Calls, sizeof(LastCalls));
+    LastRefreshFrame = GFrameCounter;
+    LastRefreshTime = FPlatformTime::Seconds();
+    LastPreviewTraces = InCharacter ? InCharacter->GetNumPreviewTraces() : 0;
+    Refresh();
+
+    DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateRaw(this, &FSurvivalDebugOverlay::Draw));
+}
+
+FSurvivalDebugOverlay::~FSurvivalDebugOverlay()
+{
+    UDebugDrawService::Unregister(DrawHandle);
+    --FSurvivalDebugTimers::NumListeners;
+}
+
+void FSurvivalDebugOverlay::Draw(UCanvas* Canvas, APlayerController* PlayerController)
+{
+    if (!Canvas || !Canvas->Canvas || !Character.IsValid() || Character->GetController() != PlayerController) return;
+
+    if (FPlatformTime::Seconds() - LastRefreshTime >= RefreshInterval)
+    {
+        Refresh();
+    }
+
+    const UFont* Font = GEngine->GetSmallFont();
+    const float LineHeight = Font->GetMaxCharHeight();
+    float Y = Canvas->SizeY * 0.15f;
+    for (const FString& Line : Lines)
+    {
+        Canvas->Canvas->DrawShadowedString(20.0f, Y, *Line, Font, FLinearColor::White);
+        Y += LineHeight;
+    }
+}
+
+void FSurvivalDebugOverlay::Refresh()
+{
+    APlayerCharacter* Player = Character.Get();
+    if (!Player) return;
+
+    const double Now = FPlatformTime::Seconds();
+    const uint64 Frames = FMath::Max<uint64>(GFrameCounter - LastRefreshFrame, 1);
+    const double Seconds = FMath::Max(Now - LastRefreshTime, UE_SMALL_NUMBER);
+    LastRefreshTime = Now;
+    LastRefreshFrame = GFrameCounter;
+
+    Lines[0].Reset();
+    Lines[0].Appendf(TEXT("Health: %.1f  Hunger: %.1f  Stamina: %.1f"),
+        Player->GetHealth(), Player->GetHunger(), Player->GetStamina());
+
+    Lines[1].Reset();
+    Lines[1].Appendf(TEXT("Wood: %d  Stone: %d  Berries: %d"),
+        Player->GetWood(), Player->GetStone(), Player->GetBerries());
+
+    const uint32 PreviewTraces = Player->GetNumPreviewTraces();
+    Lines[2].Reset();
+    if (Player->IsBuildingMode())
+    {
+        Lines[2].Appendf(TEXT("Currently Building  Preview traces: %.1f/s"), (PreviewTraces - LastPreviewTraces) / Seconds);
+    }
+    LastPreviewTraces = PreviewTraces;
+
+    Lines[3].Reset();
+    Lines[3].Appendf(TEXT("System costs (ms/frame, calls/frame over %llu frames):"), Frames);
+
+    for (int32 i = 0; i < FSurvivalDebugTimers::NumTimers; ++i)
+    {
+        const uint64 Cycles = FSurvivalDebugTimers::Cycles[i] - LastCycles[i];
+        const uint32 Calls = FSurvivalDebugTimers::Calls[i] - LastCalls[i];
+        LastCycles[i] = FSurvivalDebugTimers::Cycles[i];
+        LastCalls[i] = FSurvivalDebugTimers::Calls[i];
+
+        FString& Line = Lines[NumFixedLines + i];
+        Line.Reset();
+        Line.Appendf(TEXT("- %s: %.3f ms, %.1f calls"),
+            FSurvivalDebugTimers::GetName(static_cast<ESurvivalDebugTimer>(i)),
+            FPlatformTime::ToMilliseconds64(Cycles) / Frames,
+            static_cast<double>(Calls) / Frames);
+    }
+}
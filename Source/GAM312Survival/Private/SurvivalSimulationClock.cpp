@@ -0,0 +1,63 @@
+#include "SurvivalSimulationClock.h"
+#include "HAL/IConsoleManager.h"
+
+namespace SurvivalSimulationClock
+{
+    float FixedStepRate = 0.0f;
+    FAutoConsoleVariableRef CVarFixedStepRate(
+        TEXT("survival.FixedStepRate"),
+        FixedStepRate,
+        TEXT("Rate in Hz at which survival systems simulate. 0 uses each system's own cadence."),
+        ECVF_Default
+    );
+
+    int32 MaxSubSteps = 4;
+    FAutoConsoleVariableRef CVarMaxSubSteps(
+        TEXT("survival.MaxSubSteps"),
+        MaxSubSteps,
+        TEXT("Maximum simulation steps a survival system runs in one frame when catching up."),
+        ECVF_Default
+    );
+}
+
+bool FSurvivalSimulationClock::IsFixedStepEnabled()
+{
+    return SurvivalSimulationClock::FixedStepRate > 0.0f;
+}
+
+int32 FSurvivalSimulationClock::Advance(float DeltaTime)
+{
+    bVariableStep = false;
+
+    if (IsFixedStepEnabled())
+    {
+        StepSeconds = 1.0f / SurvivalSimulationClock::FixedStepRate;
+    }
+    else if (DefaultStepSeconds > 0.0f)
+    {
+        StepSeconds = DefaultStepSeconds;
+    }
+    else
+    {
+        // Variable rate, one step covering the whole frame
+        bVariableStep = true;
+        StepSeconds = DeltaTime;
+        Accumulator = 0.0f;
+        SimulationTime += DeltaTime;
+        return DeltaTime > 0.0f ? 1 : 0;
+    }
+
+    Accumulator += DeltaTime;
+    int32 Steps = FMath::FloorToInt(Accumulator / StepSeconds);
+
+    // Drop whole steps past the limit so a long hitch cannot snowball
+    if (bBoundSubSteps && Steps > SurvivalSimulationClock::MaxSubSteps)
+    {
+        Steps = FMath::Max(SurvivalSimulationClock::MaxSubSteps, 1);
+        Accumulator = FMath::Fmod(Accumulator, StepSeconds) + Steps * StepSeconds;
+    }
+
+    Accumulator -= Steps * StepSeconds;
+    SimulationTime += Steps * StepSeconds;
+    return Steps;
+}
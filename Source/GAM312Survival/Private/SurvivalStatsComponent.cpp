@@ -0,0 +1,122 @@
+#include "SurvivalStatsComponent.h"
+#include "SurvivalStatsSubsystem.h"
+
+USurvivalStatsComponent::USurvivalStatsComponent()
+{
+    // Stats are advanced by the subsystem, never by the component
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void USurvivalStatsComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    StatsSubsystem = GetWorld()->GetSubsystem<USurvivalStatsSubsystem>();
+    if (StatsSubsystem)
+    {
+        StatsSubsystem->AddSurvivor(this);
+    }
+}
+
+void USurvivalStatsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (StatsSubsystem)
+    {
+        StatsSubsystem->RemoveSurvivor(this);
+        StatsSubsystem = nullptr;
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void USurvivalStatsComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    if (StatsSubsystem && StatsSlot != INDEX_NONE)
+    {
+        StatsSubsystem->UpdateRates(StatsSlot);
+    }
+}
+#endif
+
+float USurvivalStatsComponent::GetInitialStat(ESurvivalStat Stat) const
+{
+    float InitialValue = 0.0f;
+    switch (Stat)
+    {
+    case ESurvivalStat::Health:  InitialValue = InitialHealth; break;
+    case ESurvivalStat::Hunger:  InitialValue = InitialHunger; break;
+    case ESurvivalStat::Stamina: InitialValue = InitialStamina; break;
+    }
+
+    // Ensure valid starting values
+    const float MaxValue = GetMaxStat(Stat);
+    return (InitialValue <= 0 || InitialValue > MaxValue) ? MaxValue : InitialValue;
+}
+
+float USurvivalStatsComponent::GetStat(ESurvivalStat Stat) const
+{
+    if (StatsSubsystem && StatsSlot != INDEX_NONE)
+    {
+        return StatsSubsystem->GetValue(StatsSlot, Stat);
+    }
+    return GetInitialStat(Stat);
+}
+
+float USurvivalStatsComponent::GetMaxStat(ESurvivalStat Stat) const
+{
+    switch (Stat)
+    {
+    case ESurvivalStat::Hunger:  return MaxHunger;
+    case ESurvivalStat::Stamina: return MaxStamina;
+    default:                     return MaxHealth;
+    }
+}
+
+void USurvivalStatsComponent::SetStat(ESurvivalStat Stat, float NewValue)
+{
+    if (StatsSubsystem && StatsSlot != INDEX_NONE)
+    {
+        StatsSubsystem->SetValue(StatsSlot, Stat, NewValue);
+        return;
+    }
+
+    // Not playing yet, adjust the starting value instead
+    const float Clamped = FMath::Clamp(NewValue, 0.0f, GetMaxStat(Stat));
+    switch (Stat)
+    {
+    case ESurvivalStat::Health:  InitialHealth = Clamped; break;
+    case ESurvivalStat::Hunger:  InitialHunger = Clamped; break;
+    case ESurvivalStat::Stamina: InitialStamina = Clamped; break;
+    }
+}
+
+void USurvivalStatsComponent::SetRate(ESurvivalRate Rate, float NewValue)
+{
+    const float Clamped = FMath::Max(NewValue, 0.0f);
+    switch (Rate)
+    {
+    case ESurvivalRate::HungerDecay:      HungerDecayRate = Clamped; break;
+    case ESurvivalRate::StarvationDamage: StarvationDamageRate = Clamped; break;
+    case ESurvivalRate::StaminaRestore:   StaminaRestoreRate = Clamped; break;
+    case ESurvivalRate::StaminaDrain:     StaminaDrainRate = Clamped; break;
+    }
+
+    // The subsystem keeps its own copy of the rates
+    if (StatsSubsystem && StatsSlot != INDEX_NONE)
+    {
+        StatsSubsystem->UpdateRates(StatsSlot);
+    }
+}
+
+void USurvivalStatsComponent::SetStaminaDraining(bool bDraining)
+{
+    bStaminaDraining = bDraining;
+
+    if (StatsSubsystem && StatsSlot != INDEX_NONE)
+    {
+        StatsSubsystem->SetStaminaDraining(StatsSlot, bDraining);
+    }
+}
@@ -0,0 +1,259 @@
+#include "SurvivalStatsSubsystem.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
+
+void USurvivalStatsSubsystem::AddSurvivor(USurvivalStatsComponent* Component)
+{
+    if (!Component || Component->StatsSlot != INDEX_NONE) return;
+
+    Component->StatsSlot = Owners.Add(Component);
+    INC_DWORD_STAT(STAT_SurvivalSurvivors);
+
+    Health.Add(Component->GetInitialStat(ESurvivalStat::Health));
+    Hunger.Add(Component->GetInitialStat(ESurvivalStat::Hunger));
+    Stamina.Add(Component->GetInitialStat(ESurvivalStat::Stamina));
+
+    MaxHealth.Add(Component->MaxHealth);
+    MaxHunger.Add(Component->MaxHunger);
+    MaxStamina.Add(Component->MaxStamina);
+
+    HungerDecayRate.Add(Component->HungerDecayRate);
+    StarvationDamageRate.Add(Component->StarvationDamageRate);
+    StaminaRestoreRate.Add(Component->StaminaRestoreRate);
+    StaminaDrainRate.Add(Component->StaminaDrainRate);
+    StaminaRate.Add(Component->IsStaminaDraining() ? -Component->StaminaDrainRate : Component->StaminaRestoreRate);
+
+    const float Quantum = Component->StatChangeQuantum;
+    StatQuantum.Add(Quantum);
+    PublishedHealth.Add(Quantize(Health.Last(), Quantum));
+    PublishedHunger.Add(Quantize(Hunger.Last(), Quantum));
+    PublishedStamina.Add(Quantize(Stamina.Last(), Quantum));
+}
+
+void USurvivalStatsSubsystem::RemoveSurvivor(USurvivalStatsComponent* Component)
+{
+    if (!Component || !Owners.IsValidIndex(Component->StatsSlot)) return;
+
+    const int32 Slot = Component->StatsSlot;
+
+    // Swap the last survivor into the freed slot so every array stays dense
+    for (TArray<float>* Values : { &Health, &Hunger, &Stamina, &MaxHealth, &MaxHunger, &MaxStamina,
+        &HungerDecayRate, &StarvationDamageRate, &StaminaRate, &StaminaRestoreRate, &StaminaDrainRate,
+        &StatQuantum, &PublishedHealth, &PublishedHunger, &PublishedStamina })
+    {
+        Values->RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    }
+    Owners.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+
+    if (Owners.IsValidIndex(Slot))
+    {
+        Owners[Slot]->StatsSlot = Slot;
+    }
+    Component->StatsSlot = INDEX_NONE;
+    DEC_DWORD_STAT(STAT_SurvivalSurvivors);
+}
+
+TArray<float>& USurvivalStatsSubsystem::GetValues(ESurvivalStat Stat)
+{
+    switch (Stat)
+    {
+    case ESurvivalStat::Hunger:  return Hunger;
+    case ESurvivalStat::Stamina: return Stamina;
+    default:                     return Health;
+    }
+}
+
+const TArray<float>& USurvivalStatsSubsystem::GetValues(ESurvivalStat Stat) const
+{
+    return const_cast<USurvivalStatsSubsystem*>(this)->GetValues(Stat);
+}
+
+const TArray<float>& USurvivalStatsSubsystem::GetMaxValues(ESurvivalStat Stat) const
+{
+    switch (Stat)
+    {
+    case ESurvivalStat::Hunger:  return MaxHunger;
+    case ESurvivalStat::Stamina: return MaxStamina;
+    default:                     return MaxHealth;
+    }
+}
+
+TArray<float>& USurvivalStatsSubsystem::GetPublishedValues(ESurvivalStat Stat)
+{
+    switch (Stat)
+    {
+    case ESurvivalStat::Hunger:  return PublishedHunger;
+    case ESurvivalStat::Stamina: return PublishedStamina;
+    default:                     return PublishedHealth;
+    }
+}
+
+float USurvivalStatsSubsystem::Quantize(float Value, float Quantum)
+{
+    return (Quantum > 0.0f) ? FMath::RoundToFloat(Value / Quantum) * Quantum : Value;
+}
+
+bool USurvivalStatsSubsystem::UpdatePublished(int32 Slot, ESurvivalStat Stat)
+{
+    const float Quantized = Quantize(GetValues(Stat)[Slot], StatQuantum[Slot]);
+    float& Published = GetPublishedValues(Stat)[Slot];
+    if (Quantized == Published) return false;
+
+    Published = Quantized;
+    return true;
+}
+
+float USurvivalStatsSubsystem::GetValue(int32 Slot, ESurvivalStat Stat) const
+{
+    const TArray<float>& Values = GetValues(Stat);
+    return Values.IsValidIndex(Slot) ? Values[Slot] : 0.0f;
+}
+
+void USurvivalStatsSubsystem::SetValue(int32 Slot, ESurvivalStat Stat, float NewValue)
+{
+    if (!Owners.IsValidIndex(Slot)) return;
+
+    TArray<float>& Values = GetValues(Stat);
+    const float OldValue = Values[Slot];
+    const float MaxValue = GetMaxValues(Stat)[Slot];
+    const float ClampedValue = FMath::Clamp(NewValue, 0.0f, MaxValue);
+    Values[Slot] = ClampedValue;
+
+    // Resolve everything up front, listeners may remove the survivor while being notified
+    USurvivalStatsComponent* Component = Owners[Slot];
+    const bool bChanged = UpdatePublished(Slot, Stat);
+    const bool bDepleted = Stat == ESurvivalStat::Health && OldValue > 0.0f && ClampedValue <= 0.0f;
+
+    if (bChanged)
+    {
+        Component->OnStatChanged.Broadcast(Stat, ClampedValue, MaxValue);
+    }
+    if (bDepleted)
+    {
+        Component->OnHealthDepleted.Broadcast();
+    }
+}
+
+void USurvivalStatsSubsystem::UpdateRates(int32 Slot)
+{
+    if (!Owners.IsValidIndex(Slot)) return;
+
+    const USurvivalStatsComponent* Component = Owners[Slot];
+    HungerDecayRate[Slot] = Component->HungerDecayRate;
+    StarvationDamageRate[Slot] = Component->StarvationDamageRate;
+    StaminaRestoreRate[Slot] = Component->StaminaRestoreRate;
+    StaminaDrainRate[Slot] = Component->StaminaDrainRate;
+    StaminaRate[Slot] = Component->IsStaminaDraining() ? -Component->StaminaDrainRate : Component->StaminaRestoreRate;
+}
+
+void USurvivalStatsSubsystem::SetStaminaDraining(int32 Slot, bool bDraining)
+{
+    if (!Owners.IsValidIndex(Slot)) return;
+
+    StaminaRate[Slot] = bDraining ? -StaminaDrainRate[Slot] : StaminaRestoreRate[Slot];
+}
+
+void USurvivalStatsSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Apply every whole step in one pass; the math is exact for any elapsed time
+    const int32 Steps = Clock.Advance(DeltaTime);
+    if (Steps == 0) return;
+
+    AdvanceAll(Steps * Clock.GetStepSeconds());
+}
+
+void USurvivalStatsSubsystem::AdvanceAll(float ElapsedSeconds)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalStats);
+    SURVIVAL_DEBUG_TIMER(SurvivalStats);
+
+    const int32 Num = Owners.Num();
+    const float Dt = ElapsedSeconds;
+
+    float* RESTRICT HealthData = Health.GetData();
+    float* RESTRICT HungerData = Hunger.GetData();
+    float* RESTRICT StaminaData = Stamina.GetData();
+    const float* RESTRICT MaxHealthData = MaxHealth.GetData();
+    const float* RESTRICT MaxStaminaData = MaxStamina.GetData();
+    const float* RESTRICT DecayData = HungerDecayRate.GetData();
+    const float* RESTRICT StarvationData = StarvationDamageRate.GetData();
+    const float* RESTRICT StaminaRateData = StaminaRate.GetData();
+
+    // Flagged in the main loop and collected afterwards, so the loop never appends
+    DepletedMask.SetNumUninitialized(Num, EAllowShrinking::No);
+    uint8* RESTRICT DepletedData = DepletedMask.GetData();
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const float OldHunger = HungerData[i];
+        const float Decay = DecayData[i];
+        const float NewHunger = FMath::Max(OldHunger - Decay * Dt, 0.0f);
+
+        // Starvation only applies to the part of the step after hunger ran out
+        const float FedTime = (Decay > 0.0f) ? OldHunger / Decay : ((OldHunger > 0.0f) ? Dt : 0.0f);
+        const float StarvingTime = (NewHunger > 0.0f) ? 0.0f : FMath::Max(Dt - FedTime, 0.0f);
+
+        const float OldHealth = HealthData[i];
+        const float NewHealth = FMath::Clamp(OldHealth - StarvingTime * StarvationData[i], 0.0f, MaxHealthData[i]);
+
+        HungerData[i] = NewHunger;
+        HealthData[i] = NewHealth;
+        StaminaData[i] = FMath::Clamp(StaminaData[i] + StaminaRateData[i] * Dt, 0.0f, MaxStaminaData[i]);
+        DepletedData[i] = (OldHealth > 0.0f) & (NewHealth <= 0.0f);
+    }
+
+    // Resolve the owners first, listeners may remove survivors while being notified
+    TArray<USurvivalStatsComponent*, TInlineAllocator<8>> Depleted;
+    for (int32 i = 0; i < Num; ++i)
+    {
+        if (DepletedData[i])
+        {
+            Depleted.Add(Owners[i]);
+        }
+    }
+
+    PublishChanges();
+
+    for (USurvivalStatsComponent* Component : Depleted)
+    {
+        Component->OnHealthDepleted.Broadcast();
+    }
+}
+
+void USurvivalStatsSubsystem::PublishChanges()
+{
+    struct FPendingChange
+    {
+        USurvivalStatsComponent* Component;
+        ESurvivalStat Stat;
+        float Value;
+        float MaxValue;
+    };
+
+    // Gather first, listeners may remove survivors while being notified
+    TArray<FPendingChange, TInlineAllocator<16>> Pending;
+    for (const ESurvivalStat Stat : { ESurvivalStat::Health, ESurvivalStat::Hunger, ESurvivalStat::Stamina })
+    {
+        const TArray<float>& Values = GetValues(Stat);
+        const TArray<float>& MaxValues = GetMaxValues(Stat);
+        for (int32 i = 0; i < Owners.Num(); ++i)
+        {
+            if (UpdatePublished(i, Stat))
+            {
+                Pending.Add({ Owners[i], Stat, Values[i], MaxValues[i] });
+            }
+        }
+    }
+
+    for (const FPendingChange& Change : Pending)
+    {
+        Change.Component->OnStatChanged.Broadcast(Change.Stat, Change.Value, Change.MaxValue);
+    }
+}
+
+TStatId USurvivalStatsSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USurvivalStatsSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,58 @@
+#include "WanderSchedulerSubsystem.h"
+#include "ButterflyWander.h"
+#include "HAL/IConsoleManager.h"
+#include "SurvivalDebugOverlay.h"
+#include "GAM312Survival.h"
+
+namespace WanderScheduler
+{
+    bool bEnabled = true;
+    FAutoConsoleVariableRef CVarEnabled(
+        TEXT("survival.Butterfly.WanderScheduler"),
+        bEnabled,
+        TEXT("Retarget butterflies through the shared wander scheduler instead of a timer each."),
+        ECVF_Default
+    );
+}
+
+bool UWanderSchedulerSubsystem::IsEnabled()
+{
+    return WanderScheduler::bEnabled;
+}
+
+void UWanderSchedulerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Random.GenerateNewSeed();
+}
+
+void UWanderSchedulerSubsystem::ScheduleRetarget(AButterflyWander* Butterfly, float DelaySeconds)
+{
+    if (Butterfly)
+    {
+        Wheel.Schedule(Butterfly, DelaySeconds);
+    }
+}
+
+void UWanderSchedulerSubsystem::Tick(float DeltaTime)
+{
+    SURVIVAL_SCOPE_CYCLE_COUNTER(STAT_SurvivalWanderScheduler);
+    SURVIVAL_DEBUG_TIMER(Butterflies);
+
+    Super::Tick(DeltaTime);
+
+    // Retargeting schedules the butterfly's next retarget
+    Wheel.Advance(DeltaTime, [](const TWeakObjectPtr<AButterflyWander>& Butterfly)
+    {
+        if (AButterflyWander* Resolved = Butterfly.Get())
+        {
+            Resolved->UpdateTargetLocation();
+        }
+    });
+}
+
+TStatId UWanderSchedulerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UWanderSchedulerSubsystem, STATGROUP_Tickables);
+}
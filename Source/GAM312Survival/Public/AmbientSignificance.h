@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "AmbientSignificance.generated.h"
+
+/**
+ * @enum EAmbientSignificance
+ * @brief How much attention an ambient actor gets, from most to least
+ */
+UENUM(BlueprintType)
+enum class EAmbientSignificance : uint8
+{
+    Near,    ///< Close to a viewer, ticks every frame
+    Mid,     ///< Visible at mid range, ticks at a reduced rate
+    Dormant, ///< Visible but far away, ticks rarely
+    Culled   ///< Out of view or out of range, does not tick at all
+};
+
+UINTERFACE(MinimalAPI, Meta = (CannotImplementInterfaceInBlueprint))
+class UAmbientSignificance : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/**
+ * @class IAmbientSignificance
+ * @brief Implemented by ambient actors whose ticking is throttled by significance
+ *
+ * The ambient significance subsystem sets the actor's tick interval for its bucket and
+ * disables ticking entirely while culled. Time spent culled is handed back on waking
+ * up, so the actor can catch up instead of resuming from a stale state.
+ */
+class GAM312SURVIVAL_API IAmbientSignificance
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Called when the actor moves to another significance bucket
+     * @param NewSignificance - Bucket the actor is now in
+     * @param SuspendedSeconds - Time spent culled when waking up, 0 otherwise
+     */
+    virtual void OnSignificanceChanged(EAmbientSignificance NewSignificance, float SuspendedSeconds) = 0;
+
+    /**
+     * @brief Checks whether the actor was drawn lately, for actors drawn by a shared batch
+     *        instead of their own primitives
+     * @param Viewpoint - Viewer the actor is scored for
+     * @param Tolerance - How long ago the actor may have been drawn, in seconds
+     * @return True if the actor was recently visible
+     */
+    virtual bool WasRecentlyVisible(const FTransform& Viewpoint, float Tolerance) const = 0;
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AmbientSignificance.h"
+#include "AmbientSignificanceSubsystem.generated.h"
+
+/**
+ * @struct FAmbientSignificanceState
+ * @brief Bucket bookkeeping for one registered ambient actor
+ */
+struct FAmbientSignificanceState
+{
+    /* Interface of the actor, resolved once on registration */
+    IAmbientSignificance* Ambient = nullptr;
+
+    /* Current bucket */
+    EAmbientSignificance Significance = EAmbientSignificance::Near;
+
+    /* World time the actor was culled at */
+    double SuspendTime = 0.0;
+};
+
+/**
+ * @class UAmbientSignificanceSubsystem
+ * @brief Buckets ambient actors by distance and visibility through the significance manager
+ *
+ * Registered actors are evaluated against every player viewpoint a few times per second.
+ * Near actors tick every frame, mid range and dormant ones at the reduced intervals set
+ * by the survival.Significance cvars, and culled ones (out of view or past the cull
+ * distance) stop ticking entirely until they become significant again.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UAmbientSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static constexpr int32 NumBuckets = static_cast<int32>(EAmbientSignificance::Culled) + 1;
+
+    /**
+     * @brief Starts throttling an actor
+     * @param Actor - Actor to register, must implement IAmbientSignificance
+     * @return True if the actor was registered
+     */
+    bool Register(AActor* Actor);
+
+    /**
+     * @brief Stops throttling an actor
+     * @param Actor - Actor to remove
+     */
+    void Unregister(AActor* Actor);
+
+    /**
+     * @brief Gets the number of actors in a bucket
+     * @param Significance - Bucket to count
+     * @return Number of registered actors in the bucket
+     */
+    int32 GetNumInBucket(EAmbientSignificance Significance) const { return BucketCounts[static_cast<int32>(Significance)]; }
+
+    /**
+     * @brief Records a tick of an ambient actor for reporting
+     * @param Significance - Bucket of the ticking actor
+     */
+    static void CountTick(EAmbientSignificance Significance) { ++TickCounts[static_cast<int32>(Significance)]; }
+
+    /* Ticks per bucket since startup */
+    static uint64 TickCounts[NumBuckets];
+
+    /* Updates significance at the configured rate */
+    virtual void Tick(float DeltaTime) override;
+
+    /* Only tick while there are ambient actors */
+    virtual bool IsTickable() const override { return States.Num() > 0; }
+
+    virtual TStatId GetStatId() const override;
+
+private:
+    /* Bookkeeping per registered actor */
+    TMap<TObjectKey<AActor>, FAmbientSignificanceState> States;
+
+    /* Registered actors per bucket */
+    int32 BucketCounts[NumBuckets] = {};
+
+    /* Player viewpoints, reused between updates */
+    TArray<FTransform> Viewpoints;
+
+    /* Time since the last significance update */
+    float TimeSinceUpdate = 0.0f;
+
+    /* Scores an actor for one viewpoint, higher is more significant */
+    static float CalculateSignificance(const AActor* Actor, const FTransform& Viewpoint);
+
+    /* Applies the tick settings of a new bucket */
+    void ApplySignificance(AActor* Actor, EAmbientSignificance NewSignificance);
+};
@@ -2,8 +2,21 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "BerryInstanceSubsystem.h"
+#include "Interactable.h"
 #include "BerryBush.generated.h"
 
+/**
+ * @enum EBerryRegrowthMode
+ * @brief Defines how a berry bush advances its regrowth
+ */
+UENUM(BlueprintType)
+enum class EBerryRegrowthMode : uint8
+{
+    Batched UMETA(DisplayName = "Batched"), ///< Advanced every frame by UBerryRegrowthSubsystem
+    Lazy    UMETA(DisplayName = "Lazy")     ///< Computed on demand from the collect time, no per-frame work
+};
+
 /**
  * @class ABerryBush
  * @brief Represents a berry bush actor in the game world that players can harvest
@@ -11,9 +24,13 @@
  * This class manages a bush with collectable berries that regrow over time.
  * It includes both visual representation (meshes) and growth mechanics.
  * The berries visually grow back using both scaling and material effects.
+ * Bushes do not tick; regrowth is either driven by UBerryRegrowthSubsystem or
+ * computed lazily from the time of collection (see EBerryRegrowthMode).
+ * With bUseInstancedBerries the berries are drawn by UBerryInstanceSubsystem instead
+ * of the bush's own BerryMesh component.
  */
 UCLASS()
-class GAM312SURVIVAL_API ABerryBush : public AActor
+class GAM312SURVIVAL_API ABerryBush : public AActor, public IInteractable
 {
     GENERATED_BODY()
 
@@ -25,8 +42,8 @@ protected:
     /* Called when the game starts or when spawned */
     virtual void BeginPlay() override;
 
-    /* Called every frame to update berry growth */
-    virtual void Tick(float DeltaTime) override;
+    /* Stops any pending regrowth when the bush leaves play */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     /* Static mesh component for the bush base structure */
     UPROPERTY(EditAnywhere, Category = "Meshes", Meta = (ToolTip = "The main bush mesh that remains visible at all times"))
@@ -36,10 +53,30 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Meshes", Meta = (ToolTip = "The berry mesh that scales and potentially disappears when harvested"))
     UStaticMeshComponent* BerryMesh;
 
+    /* Whether the berries are drawn through the shared instanced berry meshes */
+    UPROPERTY(EditAnywhere, Category = "Meshes", Meta = (ToolTip = "Draw the berries through a shared instanced mesh with growth passed as per-instance custom data. The berry material must read PerInstanceCustomData[0]"))
+    bool bUseInstancedBerries = false;
+
     /* Time in seconds for berries to fully regrow */
     UPROPERTY(EditAnywhere, Category = "Growth", Meta = (ClampMin = "0.0", ToolTip = "Duration in seconds for berries to completely regrow"))
     float RegrowthTime = 10.0f;
 
+    /* How the regrowth is advanced */
+    UPROPERTY(EditAnywhere, Category = "Growth", Meta = (ToolTip = "Batched regrowth is updated every frame by a shared manager, lazy regrowth only when the visuals need to change"))
+    EBerryRegrowthMode RegrowthMode = EBerryRegrowthMode::Batched;
+
+    /* Number of discrete visual steps used while regrowing */
+    UPROPERTY(EditAnywhere, Category = "Growth", Meta = (ClampMin = "0", ToolTip = "Number of visual growth steps pushed to the mesh and material. 0 updates the visuals continuously"))
+    int32 VisualSteps = 8;
+
+    /* Stamina consumed when collecting berries */
+    UPROPERTY(EditAnywhere, Category = "Interaction", Meta = (ClampMin = "0.0"))
+    float HarvestStaminaCost = 3.0f;
+
+    /* Number of berries handed out per collection */
+    UPROPERTY(EditAnywhere, Category = "Interaction", Meta = (ClampMin = "1"))
+    int32 BerriesPerHarvest = 1;
+
     /* Material parameter name for controlling berry growth visualization */
     UPROPERTY(EditAnywhere, Category = "Growth", Meta = (ToolTip = "Parameter name in the material that controls growth visualization"))
     FName GrowthParameterName = TEXT("Growth");
@@ -51,6 +88,34 @@ protected:
     /* Current progress of berry regrowth (0.0 to 1.0) */
     float RegrowthProgress = 1.0f;
 
+    /* Handle of the bush in the interactable index */
+    int32 InteractableHandle = INDEX_NONE;
+
+    /* Handle of the shared berry instance when using instanced berries */
+    FBerryInstanceHandle BerryInstance;
+
+    /* World transform of the berry instance for a given growth value */
+    FTransform GetBerryInstanceTransform(float Growth) const;
+
+    /* Growth value last pushed to the berry mesh and material */
+    float DisplayedProgress = 1.0f;
+
+    /* World time (in seconds) at which the berries were last collected */
+    double CollectTime = 0.0;
+
+    /* Timer handle for lazy regrowth visual steps */
+    FTimerHandle RegrowthTimerHandle;
+
+    /* Registers the regrowth with the subsystem or schedules the lazy step timer */
+    void StartRegrowth();
+
+    /* Computes the regrowth progress from the time of collection */
+    float ComputeRegrowthProgress() const;
+
+    /* Lazy regrowth timer callback */
+    UFUNCTION()
+    void OnRegrowthTimer();
+
 public:
    /**
     * @brief Collects berries from the bush if available
@@ -63,6 +128,43 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Interaction")
     void CollectBerry();
 
+    /* Previews collecting the berries */
+    virtual FInteractionResult GetInteraction(int32 Item) const override;
+
+    /* Collects the berries if available */
+    virtual FInteractionResult Interact(AActor* Instigator, int32 Item) override;
+
+    /**
+     * @brief Applies a regrowth progress value to the bush
+     * @param Progress - Regrowth progress from 0.0 to 1.0
+     *
+     * Updates the berry scale and material, and makes the berries available
+     * again once progress reaches 1.0. Called by UBerryRegrowthSubsystem.
+     */
+    void ApplyRegrowthProgress(float Progress);
+
+    /**
+     * @brief Brings a lazily regrowing bush up to date
+     *
+     * Computes the progress from the collect time and pushes it to the visuals.
+     * Called on interaction and whenever the bush needs to show its current state.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Growth")
+    void RefreshRegrowth();
+
+    /**
+     * @brief Gets the current regrowth progress
+     * @return Regrowth progress from 0.0 to 1.0
+     */
+    UFUNCTION(BlueprintPure, Category = "Growth")
+    float GetRegrowthProgress() const;
+
+    /**
+     * @brief Switches how the regrowth is advanced, e.g. to compare both modes in a benchmark
+     * @param NewMode - Regrowth mode; a regrowth in progress continues under it
+     */
+    void SetRegrowthMode(EBerryRegrowthMode NewMode);
+
     /* Tracks whether berries have been collected and are currently regrowing */
     UPROPERTY(EditAnywhere, Category = "Growth", Meta = (ToolTip = "True if berries have been collected and are regrowing"))
     bool bIsCollected = false;
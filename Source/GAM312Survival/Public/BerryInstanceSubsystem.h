@@ -0,0 +1,153 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BerryInstanceSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+
+/**
+ * @struct FBerryInstanceHandle
+ * @brief Identifies a single berry instance owned by UBerryInstanceSubsystem
+ */
+struct FBerryInstanceHandle
+{
+    /* Static mesh the instance is drawn with */
+    UStaticMesh* Mesh = nullptr;
+
+    /* Material the instance is drawn with */
+    UMaterialInterface* Material = nullptr;
+
+    /* Index of the instance in its batch's instanced component */
+    int32 InstanceIndex = INDEX_NONE;
+
+    bool IsValid() const { return Mesh != nullptr && InstanceIndex != INDEX_NONE; }
+};
+
+/**
+ * @struct FBerryInstanceBatchKey
+ * @brief Mesh and material berries must share to be drawn by the same batch
+ */
+USTRUCT()
+struct FBerryInstanceBatchKey
+{
+    GENERATED_BODY()
+
+    /* Berry mesh */
+    UPROPERTY()
+    TObjectPtr<UStaticMesh> Mesh = nullptr;
+
+    /* Berry material */
+    UPROPERTY()
+    TObjectPtr<UMaterialInterface> Material = nullptr;
+
+    FBerryInstanceBatchKey() = default;
+    FBerryInstanceBatchKey(UStaticMesh* InMesh, UMaterialInterface* InMaterial) : Mesh(InMesh), Material(InMaterial) {}
+
+    bool operator==(const FBerryInstanceBatchKey& Other) const { return Mesh == Other.Mesh && Material == Other.Material; }
+
+    friend uint32 GetTypeHash(const FBerryInstanceBatchKey& Key)
+    {
+        return HashCombine(GetTypeHash(Key.Mesh), GetTypeHash(Key.Material));
+    }
+};
+
+/**
+ * @struct FBerryInstanceBatch
+ * @brief Instanced component and free slots for one berry mesh and material
+ */
+USTRUCT()
+struct FBerryInstanceBatch
+{
+    GENERATED_BODY()
+
+    /* Component drawing every berry that uses this mesh and material */
+    UPROPERTY()
+    TObjectPtr<UInstancedStaticMeshComponent> Component = nullptr;
+
+    /* Instances released by bushes that left play, reused before adding new ones */
+    TArray<int32> FreeInstances;
+};
+
+/**
+ * @class UBerryInstanceSubsystem
+ * @brief Draws the berries of every instanced berry bush through shared instanced meshes
+ *
+ * Each distinct berry mesh and material gets one UInstancedStaticMeshComponent, so thousands of
+ * bushes collapse into a handful of draw calls and no per-bush dynamic materials.
+ * Growth is passed as per-instance custom data (index GrowthCustomDataIndex), which
+ * the berry material reads through a PerInstanceCustomData node.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UBerryInstanceSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /* Custom data slot holding the growth value (0.0 to 1.0) */
+    static constexpr int32 GrowthCustomDataIndex = 0;
+
+    /**
+     * @brief Adds a berry instance
+     * @param Mesh - Berry mesh to draw
+     * @param Material - Material to draw the mesh with (must read per-instance custom data)
+     * @param Transform - World transform of the instance
+     * @param Growth - Initial growth value
+     * @return Handle used to update or remove the instance
+     */
+    FBerryInstanceHandle AddInstance(UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& Transform, float Growth);
+
+    /**
+     * @brief Updates the transform and growth of an instance
+     * @param Handle - Instance to update
+     * @param Transform - New world transform
+     * @param Growth - New growth value
+     */
+    void UpdateInstance(const FBerryInstanceHandle& Handle, const FTransform& Transform, float Growth);
+
+    /**
+     * @brief Releases an instance so it can be reused
+     * @param Handle - Instance to remove; reset on return
+     */
+    void RemoveInstance(FBerryInstanceHandle& Handle);
+
+    /**
+     * @brief Gets the number of live berry instances drawn with a mesh and material
+     * @param Mesh - Berry mesh to query
+     * @param Material - Berry material to query
+     * @return Number of instances in use
+     */
+    int32 GetInstanceCount(UStaticMesh* Mesh, UMaterialInterface* Material) const;
+
+    /**
+     * @brief Gets the growth value stored in an instance's custom data
+     * @param Handle - Instance to query
+     * @return Growth value, or 0.0 if the handle is invalid
+     */
+    float GetInstanceGrowth(const FBerryInstanceHandle& Handle) const;
+
+    /**
+     * @brief Gets the instanced component drawing a mesh and material
+     * @param Mesh - Berry mesh to query
+     * @param Material - Berry material to query
+     * @return The component, or nullptr if no instance uses that mesh and material
+     */
+    UInstancedStaticMeshComponent* GetInstancedComponent(UStaticMesh* Mesh, UMaterialInterface* Material) const;
+
+private:
+    /* Actor owning the instanced components */
+    UPROPERTY()
+    TObjectPtr<AActor> InstanceOwner;
+
+    /* One batch per berry mesh and material */
+    UPROPERTY()
+    TMap<FBerryInstanceBatchKey, FBerryInstanceBatch> Batches;
+
+    /* Finds the batch for a mesh and material, or nullptr */
+    const FBerryInstanceBatch* FindBatch(UStaticMesh* Mesh, UMaterialInterface* Material) const;
+    FBerryInstanceBatch* FindBatch(UStaticMesh* Mesh, UMaterialInterface* Material);
+
+    /* Finds or creates the batch for a mesh and material */
+    FBerryInstanceBatch& FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material);
+};
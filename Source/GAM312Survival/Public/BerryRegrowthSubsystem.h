@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SurvivalSimulationClock.h"
+#include "BerryRegrowthSubsystem.generated.h"
+
+class ABerryBush;
+
+/**
+ * @struct FBerryRegrowthEntry
+ * @brief Bookkeeping for a single berry bush that is currently regrowing
+ */
+struct FBerryRegrowthEntry
+{
+    /* World time (in seconds) at which the berries were collected */
+    double CollectTime = 0.0;
+
+    /* Duration in seconds for the berries to completely regrow */
+    float RegrowthTime = 0.0f;
+
+    /* The bush being regrown. Removed from the subsystem in the bush's EndPlay */
+    ABerryBush* Bush = nullptr;
+};
+
+/**
+ * @class UBerryRegrowthSubsystem
+ * @brief Owns berry regrowth for every bush in the world
+ *
+ * Bushes no longer tick on their own. When berries are collected the bush registers
+ * here, and all regrowing bushes are advanced in a single pass over one contiguous array.
+ * Bushes with ripe berries are not tracked at all, so an idle map costs nothing per frame.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UBerryRegrowthSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Starts tracking regrowth for a bush
+     * @param Bush - The bush whose berries were just collected
+     * @param RegrowthTime - Duration in seconds for a full regrowth
+     * @param CollectTime - World time the berries were collected at
+     */
+    void StartRegrowth(ABerryBush* Bush, float RegrowthTime, double CollectTime);
+
+    /**
+     * @brief Stops tracking a bush without completing its regrowth
+     * @param Bush - The bush to remove
+     */
+    void CancelRegrowth(ABerryBush* Bush);
+
+    /**
+     * @brief Gets the number of bushes currently regrowing
+     * @return Number of tracked bushes
+     */
+    int32 GetNumRegrowing() const { return Entries.Num(); }
+
+    /* Advances all regrowing bushes */
+    virtual void Tick(float DeltaTime) override;
+
+    /* Only tick while there is something to regrow */
+    virtual bool IsTickable() const override { return Entries.Num() > 0; }
+
+    virtual TStatId GetStatId() const override;
+
+private:
+    /* All bushes that are currently regrowing */
+    TArray<FBerryRegrowthEntry> Entries;
+
+    /* Index into Entries of each regrowing bush, so cancelling does not scan */
+    TMap<ABerryBush*, int32> EntryIndices;
+
+    /* Steps regrowth every frame, or at the fixed simulation rate when one is set */
+    FSurvivalSimulationClock Clock;
+
+    /* Swaps an entry out and fixes up the index of the entry moved into its place */
+    void RemoveEntry(int32 Index);
+};
@@ -4,6 +4,7 @@
 #include "GameFramework/Actor.h"
 #include "Components/TimelineComponent.h"
 #include "Curves/CurveVector.h"
+#include "StructureGrid.h"
 #include "BuildableBase.generated.h"
 
 /**
@@ -74,6 +75,21 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Construction")
     int32 ConstructionCost = 10;
 
+    /* Health of the structure when placed */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Construction", meta = (ClampMin = "0.0"))
+    float MaxHealth = 100.0f;
+
+    /* Remaining health of the structure */
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category = "Construction")
+    float Health = 100.0f;
+
+    /**
+     * @brief Whether the placed structure is folded into an instanced mesh after its placement animation
+     * @tooltip Turn off for buildables that need to stay actors, e.g. ones with their own behavior
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Construction")
+    bool bCompactWhenPlaced = true;
+
     /**
      * @brief Gets the construction cost
      * @return The number of resources required to build
@@ -107,39 +123,79 @@ public:
     UPROPERTY(VisibleAnywhere, Category = "Components")
     UTimelineComponent* ScaleTimeline;
 
-    /* Curve defining scale animation */
+    /**
+     * @brief Curve defining scale animation
+     * @tooltip Leave empty to use the buildable catalog's curve
+     */
     UPROPERTY(EditDefaultsOnly, Category = "Animation")
-    UCurveVector* ScaleCurve = LoadObject<UCurveVector>(nullptr, TEXT("/Game/Blueprints/Buildables/ScaleCurve"));
+    UCurveVector* ScaleCurve = nullptr;
 
     /* Trigger placement effect animation */
     UFUNCTION(BlueprintCallable, Category = "Construction")
     void PlayPlacementEffect();
 
-protected:
-    /* Called when the game starts or when spawned */
-    virtual void BeginPlay() override;
+    /* Stops the placement animation and marks the buildable as no longer placed */
+    void StopPlacementEffect();
 
     /**
-     * @brief Range for valid placement checks
-     * @tooltip Maximum distance from ground for valid placement
+     * @brief Restores the state of a freshly spawned buildable
+     *
+     * Called by the buildable pool on reuse, after it set the acquired transform and scale:
+     * stops the placement animation, resets the health, and drops material overrides
+     * applied since, e.g. the preview material
      */
-    UPROPERTY(EditDefaultsOnly, Category = "Construction")
-    float GroundCheckDistance = 100.0f;
+    virtual void ResetPooledState();
+
+    /* Structure grid socket the buildable snapped to, or occupies once placed */
+    FStructureSlot GridSlot;
+
+    /* Whether the buildable holds GridSlot in the structure grid */
+    bool bOccupiesGridSlot = false;
+
+    /* Whether the buildable is placed in the world, as opposed to a preview or parked in the pool */
+    bool bPlaced = false;
+
+    /**
+     * @brief Fills a socket of the structure grid with the placed buildable
+     * @param Slot - Socket the buildable was placed in
+     * @param bGrounded - Whether the buildable rests on the ground rather than other parts
+     */
+    void OccupyGridSlot(const FStructureSlot& Slot, bool bGrounded);
+
+    /* Frees the buildable's socket of the structure grid, if it holds one */
+    void VacateGridSlot();
 
     /**
      * @brief Validates potential build location
      * @param OutHit - Hit result from placement check
-     * @return True if location is valid for building
+     * @return True if the structure grid has room for the buildable at GridSlot and it would be stable
      */
     UFUNCTION(BlueprintCallable, Category = "Construction")
     virtual bool IsValidPlacement(FHitResult& OutHit) const;
 
+protected:
+    /* Called when the game starts or when spawned */
+    virtual void BeginPlay() override;
+
+    /* Frees the grid socket of a destroyed structure, not when the level or play ends */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /**
+     * @brief Range for valid placement checks
+     * @tooltip Maximum distance from ground for valid placement
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Construction")
+    float GroundCheckDistance = 100.0f;
+
     /**
      * @brief Updates mesh based on current material and buildable types
-     * @tooltip Loads appropriate mesh from content directory
+     * @tooltip Uses the mesh cached by the buildable catalog
      */
     void UpdateMesh();
 
+    /* Applies the catalog's mesh and scale curve, once the catalog has loaded */
+    void ApplyCatalog();
+
     /* Timeline update callback */
     UFUNCTION()
     void UpdateScale(FVector Scale);
@@ -148,6 +204,9 @@ protected:
     UFUNCTION()
     void OnScaleTimelineCompleted();
 
+    /* Hands the placed structure to the compaction subsystem, if enabled */
+    void CompactIfPlaced();
+
 private:
     FOnTimelineVector ScaleTimelineInterp;
 };
\ No newline at end of file
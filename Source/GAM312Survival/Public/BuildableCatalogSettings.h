@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "BuildableBase.h"
+#include "BuildableCatalogSettings.generated.h"
+
+class UStaticMesh;
+class UCurveVector;
+
+/**
+ * @struct FBuildableCatalogEntry
+ * @brief Mesh of one material and structure type combination
+ */
+USTRUCT()
+struct FBuildableCatalogEntry
+{
+    GENERATED_BODY()
+
+    /* Construction material of the buildable */
+    UPROPERTY(EditAnywhere, Category = "Catalog")
+    EMaterialType MaterialType = EMaterialType::Wooden;
+
+    /* Structure type of the buildable */
+    UPROPERTY(EditAnywhere, Category = "Catalog")
+    EBuildableType BuildableType = EBuildableType::Wall;
+
+    /* Mesh drawn for the combination */
+    UPROPERTY(EditAnywhere, Category = "Catalog")
+    TSoftObjectPtr<UStaticMesh> Mesh;
+};
+
+/**
+ * @class UBuildableCatalogSettings
+ * @brief Project settings listing the assets used by buildables
+ *
+ * Stored in DefaultGame.ini and edited under Project Settings > Game > Buildable Catalog.
+ * Everything listed here is loaded asynchronously when the game starts, see
+ * UBuildableCatalogSubsystem.
+ */
+UCLASS(Config = Game, DefaultConfig, Meta = (DisplayName = "Buildable Catalog"))
+class GAM312SURVIVAL_API UBuildableCatalogSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    /* Mesh for each material and structure type */
+    UPROPERTY(Config, EditAnywhere, Category = "Catalog")
+    TArray<FBuildableCatalogEntry> Meshes;
+
+    /* Scale animation played when a buildable is placed */
+    UPROPERTY(Config, EditAnywhere, Category = "Catalog")
+    TSoftObjectPtr<UCurveVector> ScaleCurve;
+};
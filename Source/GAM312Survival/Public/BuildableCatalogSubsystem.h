@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "BuildableBase.h"
+#include "BuildableCatalogSubsystem.generated.h"
+
+struct FStreamableHandle;
+class UStaticMesh;
+class UCurveVector;
+
+/**
+ * @class UBuildableCatalogSubsystem
+ * @brief Loads the buildable catalog once and hands out cached meshes
+ *
+ * The assets listed in UBuildableCatalogSettings are requested through the streamable
+ * manager when the game instance starts and kept loaded for its lifetime. Lookups are
+ * a plain array index by material and structure type, so spawning a buildable never
+ * loads synchronously or builds asset paths.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UBuildableCatalogSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * @brief Checks whether the catalog finished loading
+     * @return True once every listed asset is resolved
+     */
+    bool IsLoaded() const { return bLoaded; }
+
+    /**
+     * @brief Gets the mesh of a material and structure type
+     * @param MaterialType - Construction material
+     * @param BuildableType - Structure type
+     * @return Cached mesh, or nullptr if none is listed or loading has not finished
+     */
+    UStaticMesh* FindMesh(EMaterialType MaterialType, EBuildableType BuildableType) const;
+
+    /**
+     * @brief Gets the placement scale animation
+     * @return Cached curve, or nullptr if none is listed or loading has not finished
+     */
+    UCurveVector* GetScaleCurve() const { return ScaleCurve; }
+
+    /* Broadcast once when loading finishes, for buildables spawned before that */
+    FSimpleMulticastDelegate OnLoaded;
+
+private:
+    /* Meshes indexed by GetMeshIndex */
+    UPROPERTY()
+    TArray<TObjectPtr<UStaticMesh>> Meshes;
+
+    /* Placement scale animation */
+    UPROPERTY()
+    TObjectPtr<UCurveVector> ScaleCurve;
+
+    /* Keeps the catalog assets loaded */
+    TSharedPtr<FStreamableHandle> LoadHandle;
+
+    /* Whether loading finished */
+    bool bLoaded = false;
+
+    /* Index of a combination in Meshes */
+    static int32 GetMeshIndex(EMaterialType MaterialType, EBuildableType BuildableType);
+
+    /* Resolves the loaded assets into the cache */
+    void HandleLoaded();
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "BuildablePoolSubsystem.generated.h"
+
+class ABuildableBase;
+
+/**
+ * @struct FBuildablePool
+ * @brief Inactive buildables of one class and how many to keep ready
+ */
+USTRUCT()
+struct FBuildablePool
+{
+    GENERATED_BODY()
+
+    /* Hidden, collision-free buildables ready to be acquired */
+    UPROPERTY()
+    TArray<TObjectPtr<ABuildableBase>> Inactive;
+
+    /* Number of inactive buildables to keep ready */
+    int32 PrewarmCount = 0;
+};
+
+/**
+ * @class UBuildablePoolSubsystem
+ * @brief Recycles buildable actors instead of spawning and destroying them
+ *
+ * Build previews are released back to the pool when building is cancelled and reused by
+ * the next session. Placement actors are pre-warmed per class while building, one spawn
+ * per frame, so placing a buildable only has to move and reveal an existing actor.
+ * Acquired buildables are reset to the state of a freshly spawned one.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UBuildablePoolSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Takes a buildable from the pool, spawning one if the pool is empty
+     * @param Class - Buildable class
+     * @param Transform - World transform to place it at
+     * @param CollisionHandling - How to handle blocking geometry at the transform, as with SpawnActor
+     * @return The buildable, or nullptr if it could not be placed
+     */
+    ABuildableBase* Acquire(TSubclassOf<ABuildableBase> Class, const FTransform& Transform, ESpawnActorCollisionHandlingMethod CollisionHandling);
+
+    /**
+     * @brief Returns a buildable to the pool of its class
+     * @param Buildable - Buildable to deactivate
+     */
+    void Release(ABuildableBase* Buildable);
+
+    /**
+     * @brief Keeps inactive buildables of a class ready, topped up one per frame
+     * @param Class - Buildable class
+     * @param Count - Number of inactive buildables to keep, 0 to use survival.BuildablePool.PrewarmCount
+     */
+    void Prewarm(TSubclassOf<ABuildableBase> Class, int32 Count = 0);
+
+    /**
+     * @brief Gets the number of inactive buildables of a class
+     * @param Class - Buildable class
+     * @return Number of pooled buildables
+     */
+    int32 GetNumInactive(TSubclassOf<ABuildableBase> Class) const;
+
+    /* Whether buildables should be pooled */
+    static bool IsEnabled();
+
+    /* Spawns one buildable for a pool below its pre-warm count */
+    virtual void Tick(float DeltaTime) override;
+
+    /* Only tick while a pool needs topping up */
+    virtual bool IsTickable() const override { return bNeedsPrewarm; }
+
+    virtual TStatId GetStatId() const override;
+
+private:
+    /* One pool per buildable class */
+    UPROPERTY()
+    TMap<TSubclassOf<ABuildableBase>, FBuildablePool> Pools;
+
+    /* Whether any pool is below its pre-warm count */
+    bool bNeedsPrewarm = false;
+
+    /* Spawns an inactive buildable */
+    ABuildableBase* SpawnInactive(TSubclassOf<ABuildableBase> Class);
+
+    /* Hides a buildable and turns off its collision */
+    static void Deactivate(ABuildableBase* Buildable);
+};
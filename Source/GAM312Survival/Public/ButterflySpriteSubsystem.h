@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ButterflySpriteSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+
+/**
+ * @struct FButterflySpriteHandle
+ * @brief Identifies a single butterfly sprite owned by UButterflySpriteSubsystem
+ */
+struct FButterflySpriteHandle
+{
+    /* Sprite mesh the instance is drawn with */
+    UStaticMesh* Mesh = nullptr;
+
+    /* Material the instance is drawn with */
+    UMaterialInterface* Material = nullptr;
+
+    /* Index of the instance in its batch's instanced component */
+    int32 InstanceIndex = INDEX_NONE;
+
+    bool IsValid() const { return Mesh != nullptr && InstanceIndex != INDEX_NONE; }
+};
+
+/**
+ * @struct FButterflySpriteBatchKey
+ * @brief Mesh and material sprites must share to be drawn by the same batch
+ */
+USTRUCT()
+struct FButterflySpriteBatchKey
+{
+    GENERATED_BODY()
+
+    /* Sprite mesh */
+    UPROPERTY()
+    TObjectPtr<UStaticMesh> Mesh = nullptr;
+
+    /* Sprite material */
+    UPROPERTY()
+    TObjectPtr<UMaterialInterface> Material = nullptr;
+
+    FButterflySpriteBatchKey() = default;
+    FButterflySpriteBatchKey(UStaticMesh* InMesh, UMaterialInterface* InMaterial) : Mesh(InMesh), Material(InMaterial) {}
+
+    bool operator==(const FButterflySpriteBatchKey& Other) const { return Mesh == Other.Mesh && Material == Other.Material; }
+
+    friend uint32 GetTypeHash(const FButterflySpriteBatchKey& Key)
+    {
+        return HashCombine(GetTypeHash(Key.Mesh), GetTypeHash(Key.Material));
+    }
+};
+
+/**
+ * @struct FButterflySpriteBatch
+ * @brief Instanced component, pending transforms and free slots for one sprite mesh and material
+ */
+USTRUCT()
+struct FButterflySpriteBatch
+{
+    GENERATED_BODY()
+
+    /* Component drawing every butterfly that uses this mesh and material */
+    UPROPERTY()
+    TObjectPtr<UInstancedStaticMeshComponent> Component = nullptr;
+
+    /* World transform of every instance, uploaded in one batch when dirty */
+    TArray<FTransform> Transforms;
+
+    /* Instances released by butterflies that left play, reused before adding new ones */
+    TArray<int32> FreeInstances;
+
+    /* Whether any transform changed since the last upload */
+    bool bDirty = false;
+};
+
+/**
+ * @class UButterflySpriteSubsystem
+ * @brief Draws butterflies as one instanced sprite batch per sprite mesh and material
+ *
+ * Replaces a flipbook component per butterfly, so the butterfly count no longer adds
+ * primitives, render proxies or draw calls. The sprite mesh is a quad whose material
+ * reads frames from a shared flipbook atlas; the frame is picked on the GPU from the
+ * game time, the instance's phase offset (PhaseCustomDataIndex) and play rate
+ * (PlayRateCustomDataIndex), read through PerInstanceCustomData nodes.
+ *
+ * Butterflies update their transform every tick; transforms are gathered and uploaded
+ * once per frame per batch.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UButterflySpriteSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /* Custom data slot holding the animation phase offset in seconds */
+    static constexpr int32 PhaseCustomDataIndex = 0;
+
+    /* Custom data slot holding the animation play rate */
+    static constexpr int32 PlayRateCustomDataIndex = 1;
+
+    /* Custom data floats per instance */
+    static constexpr int32 NumCustomDataFloats = 2;
+
+    /* Whether butterflies with a sprite mesh should be drawn through the batch */
+    static bool IsEnabled();
+
+    /**
+     * @brief Adds a butterfly sprite
+     * @param Mesh - Sprite mesh to draw
+     * @param Material - Material to draw the mesh with (must read per-instance custom data)
+     * @param Transform - World transform of the instance
+     * @param Phase - Animation phase offset in seconds
+     * @param PlayRate - Animation play rate
+     * @return Handle used to update or remove the instance
+     */
+    FButterflySpriteHandle AddInstance(UStaticMesh* Mesh, UMaterialInterface* Material, const FTransform& Transform, float Phase, float PlayRate);
+
+    /**
+     * @brief Moves a sprite, uploaded with the rest of its batch at the end of the frame
+     * @param Handle - Instance to update
+     * @param Transform - New world transform
+     */
+    void UpdateInstance(const FButterflySpriteHandle& Handle, const FTransform& Transform);
+
+    /**
+     * @brief Releases an instance so it can be reused
+     * @param Handle - Instance to remove; reset on return
+     */
+    void RemoveInstance(FButterflySpriteHandle& Handle);
+
+    /**
+     * @brief Gets the number of live sprites drawn with a mesh and material
+     * @param Mesh - Sprite mesh to query
+     * @param Material - Sprite material to query
+     * @return Number of instances in use
+     */
+    int32 GetInstanceCount(UStaticMesh* Mesh, UMaterialInterface* Material) const;
+
+    /**
+     * @brief Checks whether a sprite was likely drawn lately, standing in for the
+     *        WasRecentlyRendered of its butterfly. True when its batch was rendered and the
+     *        instance lies within the view cone of the viewpoint
+     * @param Handle - Instance to query
+     * @param Viewpoint - Viewer location and rotation
+     * @param Tolerance - How long ago the batch may have been rendered, in seconds
+     * @return True if the instance was recently visible
+     */
+    bool WasInstanceRecentlyVisible(const FButterflySpriteHandle& Handle, const FTransform& Viewpoint, float Tolerance) const;
+
+    /* Uploads the transforms of dirty batches */
+    virtual void Tick(float DeltaTime) override;
+
+    /* Only tick while there are batches */
+    virtual bool IsTickable() const override { return Batches.Num() > 0; }
+
+    virtual TStatId GetStatId() const override;
+
+private:
+    /* Actor owning the instanced components */
+    UPROPERTY()
+    TObjectPtr<AActor> InstanceOwner;
+
+    /* One batch per sprite mesh and material */
+    UPROPERTY()
+    TMap<FButterflySpriteBatchKey, FButterflySpriteBatch> Batches;
+
+    /* Finds the batch of a sprite, or nullptr */
+    const FButterflySpriteBatch* FindBatch(const FButterflySpriteHandle& Handle) const;
+    FButterflySpriteBatch* FindBatch(const FButterflySpriteHandle& Handle);
+
+    /* Finds or creates the batch for a mesh and material */
+    FButterflySpriteBatch& FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material);
+};
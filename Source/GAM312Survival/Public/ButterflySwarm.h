@@ -0,0 +1,171 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Math/RandomStream.h"
+#include "SurvivalSimulationClock.h"
+#include "ButterflySwarm.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/**
+ * @class AButterflySwarm
+ * @brief Simulates many butterflies in one actor, drawn as instances of a single mesh
+ *
+ * Butterflies wander and bob like AButterflyWander, but without one actor, tick and timer
+ * each. Their state lives in parallel arrays that are advanced four butterflies at a time
+ * with vector math, and all instance transforms are written in one batch per frame.
+ * Movement is stepped by the survival simulation clock and rendered interpolated between
+ * the last two steps. The mesh is animated like the butterfly sprite batch, from
+ * per-instance phase and play rate custom data.
+ */
+UCLASS()
+class GAM312SURVIVAL_API AButterflySwarm : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AButterflySwarm();
+
+    /* Mesh drawn for every butterfly */
+    UPROPERTY(EditAnywhere, Category = "Swarm")
+    TObjectPtr<UStaticMesh> ButterflyMesh;
+
+    /* Animation play rate passed to the sprite material with each instance's phase offset */
+    UPROPERTY(EditAnywhere, Category = "Swarm", meta = (ClampMin = "0.0"))
+    float AnimationPlayRate = 1.0f;
+
+    /* Number of butterflies in the swarm */
+    UPROPERTY(EditAnywhere, Category = "Swarm", meta = (ClampMin = "0"))
+    int32 ButterflyCount = 100;
+
+    /* Radius around the swarm within which butterflies start */
+    UPROPERTY(EditAnywhere, Category = "Swarm", meta = (ClampMin = "0.0"))
+    float SpawnRadius = 2000.0f;
+
+    /* Seed for start positions and wander targets, 0 picks one at random */
+    UPROPERTY(EditAnywhere, Category = "Swarm")
+    int32 RandomSeed = 0;
+
+    /* Movement speed */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.1"))
+    float MoveSpeed = 100.0f;
+
+    /* Maximum wander radius from starting position */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "10.0"))
+    float WanderRadius = 300.0f;
+
+    /* Time between target updates (seconds) */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.1"))
+    float WanderInterval = 3.0f;
+
+    /* Bobbing oscillation frequency */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.1"))
+    float BobbingFrequency = 1.0f;
+
+    /* Bobbing vertical amplitude */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.0"))
+    float BobbingAmplitude = 4.0f;
+
+    /* Lateral movement frequency */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.1"))
+    float LateralFrequency = 0.05f;
+
+    /* Lateral movement amplitude */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.0"))
+    float LateralAmplitude = 1.5f;
+
+    /* Vertical target variation */
+    UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.0"))
+    float ZVariationRange = 3.0f;
+
+    /**
+     * @brief Gets the number of simulated butterflies
+     * @return Butterfly count
+     */
+    int32 GetNumButterflies() const { return NumButterflies; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Tick(float DeltaTime) override;
+
+private:
+    /* Root component for transformation */
+    UPROPERTY(VisibleAnywhere, Category = "Components")
+    TObjectPtr<USceneComponent> RootComp;
+
+    /* One instance per butterfly */
+    UPROPERTY(VisibleAnywhere, Category = "Components")
+    TObjectPtr<UInstancedStaticMeshComponent> Instances;
+
+    /* Clock stepping the swarm simulation */
+    FSurvivalSimulationClock SimulationClock;
+
+    /* Source of start positions and wander targets */
+    FRandomStream Random;
+
+    /* Number of butterflies, the arrays below are padded to a multiple of four */
+    int32 NumButterflies = 0;
+
+    /* Simulated positions relative to the swarm after the latest step */
+    TArray<float> PositionX;
+    TArray<float> PositionY;
+    TArray<float> PositionZ;
+
+    /* Simulated positions after the step before, interpolated from for rendering */
+    TArray<float> PreviousX;
+    TArray<float> PreviousY;
+    TArray<float> PreviousZ;
+
+    /* Current wander targets */
+    TArray<float> TargetX;
+    TArray<float> TargetY;
+    TArray<float> TargetZ;
+
+    /* Start positions the wander radius is measured from */
+    TArray<float> StartX;
+    TArray<float> StartY;
+    TArray<float> StartZ;
+
+    /* Horizontal right direction of the current leg, for lateral movement */
+    TArray<float> RightX;
+    TArray<float> RightY;
+
+    /* Time accumulator per butterfly for bobbing and lateral movement */
+    TArray<float> Phase;
+
+    /* Horizontal distance to the target when it was picked */
+    TArray<float> InitialDistance;
+
+    /* Seconds until a new target is picked */
+    TArray<float> WanderTimeLeft;
+
+    /* Rendered height including bobbing, scratch space for writing transforms */
+    TArray<float> RenderZ;
+
+    /* Instance transforms, reused every frame */
+    TArray<FTransform> Transforms;
+
+    /* Fills the arrays and adds one instance per butterfly */
+    void SpawnButterflies();
+
+    /**
+     * @brief Advances every butterfly by one simulation step
+     * @param StepSeconds - Length of the step
+     */
+    void StepSwarm(float StepSeconds);
+
+    /**
+     * @brief Picks a new random target within the wander radius
+     * @param Index - Butterfly to retarget
+     */
+    void PickTarget(int32 Index);
+
+    /**
+     * @brief Writes every instance transform in one batch
+     * @param Alpha - Interpolation between the previous and latest step
+     */
+    void UpdateInstances(float Alpha);
+};
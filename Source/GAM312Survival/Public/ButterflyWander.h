@@ -3,17 +3,28 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "PaperFlipbookComponent.h"
+#include "SurvivalSimulationClock.h"
+#include "AmbientSignificance.h"
+#include "ButterflySpriteSubsystem.h"
 #include "ButterflyWander.generated.h"
 
+class UStaticMesh;
+class UMaterialInterface;
+
 /**
  * @class AButterflyWander
  * @brief Butterfly with wandering and bobbing behavior
  *
  * Uses Paper2D flipbooks for visualization and sinusoidal motion for bobbing effect and lateral movement.
  * Implements smooth movement between random points within a defined radius.
+ * Movement is simulated in steps of the survival simulation clock and the rendered
+ * location is interpolated between the last two steps. Ticking is throttled by the
+ * ambient significance subsystem based on distance and visibility.
+ * With a sprite mesh set, the flipbook is replaced by an instance in the butterfly
+ * sprite batch, so the butterfly adds no primitive of its own.
  */
 UCLASS()
-class GAM312SURVIVAL_API AButterflyWander : public AActor
+class GAM312SURVIVAL_API AButterflyWander : public AActor, public IAmbientSignificance
 {
     GENERATED_BODY()
 
@@ -22,8 +33,16 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
 
+public:
+    /* Adjusts to a new significance bucket, catching up on time spent culled */
+    virtual void OnSignificanceChanged(EAmbientSignificance NewSignificance, float SuspendedSeconds) override;
+
+    /* Asks the sprite batch while batched, since the butterfly then has no primitive of its own */
+    virtual bool WasRecentlyVisible(const FTransform& Viewpoint, float Tolerance) const override;
+
 private:
     /* Root component for transformation */
     UPROPERTY(VisibleAnywhere, Category = "Components")
@@ -44,7 +63,7 @@ private:
     /* Stores initial spawn location for radius constraint */
     FVector StartingLocation;
 
-    /* Timer handle for wander updates */
+    /* Timer handle for wander updates when the wander scheduler is disabled */
     FTimerHandle WanderTimerHandle;
 
     UPROPERTY(VisibleInstanceOnly, Category = "Movement")
@@ -53,15 +72,46 @@ private:
     UPROPERTY(VisibleInstanceOnly, Category = "Movement")
     float InitialDistanceToTarget;
 
+    /* Clock stepping the movement simulation, unbounded since throttled ticks cover several steps */
+    FSurvivalSimulationClock SimulationClock{ 0.0f, false };
+
+    /* Simulated location after the latest step */
+    FVector SimulatedLocation;
+
+    /* Simulated location after the step before, interpolated from for rendering */
+    FVector PreviousSimulatedLocation;
+
+    /* Current significance bucket */
+    EAmbientSignificance Significance = EAmbientSignificance::Near;
+
+    /* Instance in the sprite batch, valid when the flipbook was replaced */
+    FButterflySpriteHandle SpriteHandle;
+
+    /* Flipbook transform relative to the actor, reused for the batched sprite */
+    FTransform SpriteRelativeTransform;
+
+    /**
+     * @brief Replaces the flipbook with an instance in the sprite batch
+     * @return True if the butterfly is now drawn by the batch
+     */
+    bool MoveToSpriteBatch();
+
+    /**
+     * @brief Advances the movement simulation by one step
+     * @param StepSeconds - Length of the step
+     */
+    void StepMovement(float StepSeconds);
+
+public:
     /**
      * @brief Generates new random target location within wander radius
      *
-     * Called at regular intervals to update movement destination
+     * Called at regular intervals to update movement destination, by the wander
+     * scheduler or by the butterfly's own timer when the scheduler is disabled
      */
     UFUNCTION()
     void UpdateTargetLocation();
 
-public:
     /* Movement speed */
     UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.1"))
     float MoveSpeed = 100.0f;
@@ -93,4 +143,15 @@ public:
     /* Vertical target variation */
     UPROPERTY(EditAnywhere, Category = "Movement", meta = (ClampMin = "0.0"))
     float ZVariationRange = 3.0f;
+
+    /**
+     * @brief Quad drawn in the butterfly sprite batch instead of the flipbook
+     * @tooltip Leave empty to keep the flipbook component
+     */
+    UPROPERTY(EditAnywhere, Category = "Rendering")
+    TObjectPtr<UStaticMesh> SpriteMesh;
+
+    /* Atlas material of the sprite mesh, must read the batch's per-instance custom data */
+    UPROPERTY(EditAnywhere, Category = "Rendering")
+    TObjectPtr<UMaterialInterface> SpriteMaterial;
 };
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Interactable.generated.h"
+
+/**
+ * @enum EResourceType
+ * @brief Defines the various types of resources that can be mined in the game
+ */
+UENUM(BlueprintType)
+enum class EResourceType : uint8
+{
+    Wood,   ///< Wood resource type
+    Stone,  ///< Stone resource type
+    Berry   ///< Berry resource type
+};
+
+/**
+ * @struct FInteractionResult
+ * @brief Describes what an interaction yields and what it costs
+ */
+USTRUCT(BlueprintType)
+struct FInteractionResult
+{
+    GENERATED_BODY()
+
+    /* Type of resource handed to the interacting actor */
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+    EResourceType ResourceType = EResourceType::Wood;
+
+    /* Amount of resource handed to the interacting actor */
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+    int32 Amount = 0;
+
+    /* Stamina consumed by the interaction */
+    UPROPERTY(BlueprintReadOnly, Category = "Interaction")
+    float StaminaCost = 0.0f;
+
+    /* Whether the interaction yields anything */
+    bool IsValid() const { return Amount > 0; }
+};
+
+UINTERFACE(MinimalAPI, Meta = (CannotImplementInterfaceInBlueprint))
+class UInteractable : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/**
+ * @class IInteractable
+ * @brief Implemented by everything the player can harvest or use
+ *
+ * Interaction is dispatched through a single virtual call, no matter how many
+ * interactable types exist. The interactable index resolves the interface once per
+ * entry when it is registered, so queries never cast. The item index lets one actor
+ * expose many interactables, e.g. the nodes of a resource field.
+ */
+class GAM312SURVIVAL_API IInteractable
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Previews an interaction without changing anything
+     * @param Item - Actor specific item, INDEX_NONE for plain actors
+     * @return What the interaction would yield; an invalid result if there is nothing to interact with
+     */
+    virtual FInteractionResult GetInteraction(int32 Item) const = 0;
+
+    /**
+     * @brief Performs the interaction
+     * @param Instigator - Actor interacting
+     * @param Item - Actor specific item, INDEX_NONE for plain actors
+     * @return What the interaction actually yielded
+     */
+    virtual FInteractionResult Interact(AActor* Instigator, int32 Item) = 0;
+
+    /**
+     * @brief Resolves the item hit by a trace
+     * @param Hit - Trace hit on the implementing actor
+     * @return Actor specific item, INDEX_NONE for plain actors
+     */
+    virtual int32 GetItemForHit(const FHitResult& Hit) const { return INDEX_NONE; }
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Interactable.h"
+#include "InteractableIndexSubsystem.generated.h"
+
+/**
+ * @struct FInteractableEntry
+ * @brief A single interactable registered in the spatial index
+ */
+struct FInteractableEntry
+{
+    /* Actor handling the interaction */
+    TWeakObjectPtr<AActor> Actor;
+
+    /* Interface of the actor, resolved once on registration */
+    IInteractable* Interactable = nullptr;
+
+    /* Actor specific item, e.g. a resource field node. INDEX_NONE for plain actors */
+    int32 Item = INDEX_NONE;
+
+    /* World space center of the interactable */
+    FVector Location = FVector::ZeroVector;
+
+    /* Bounding radius used to widen the distance and view cone checks */
+    float Radius = 0.0f;
+
+    /* Grid cell the entry is stored in */
+    FIntVector Cell = FIntVector::ZeroValue;
+};
+
+/**
+ * @struct FInteractionTarget
+ * @brief Result of an interaction query
+ */
+struct FInteractionTarget
+{
+    /* Actor handling the interaction */
+    AActor* Actor = nullptr;
+
+    /* Interface to dispatch the interaction through */
+    IInteractable* Interactable = nullptr;
+
+    /* Actor specific item, e.g. a resource field node */
+    int32 Item = INDEX_NONE;
+
+    bool IsValid() const { return Interactable != nullptr; }
+};
+
+/**
+ * @struct FInteractableQuery
+ * @brief Parameters for resolving the interactable a viewer is looking at
+ */
+struct FInteractableQuery
+{
+    /* Viewer location, usually the camera */
+    FVector ViewLocation = FVector::ZeroVector;
+
+    /* Normalized view direction */
+    FVector ViewDirection = FVector::ForwardVector;
+
+    /* Maximum interaction distance */
+    float Range = 200.0f;
+
+    /* Half angle of the view cone in degrees */
+    float ConeHalfAngle = 30.0f;
+
+    /* Whether to confirm the result with a single visibility trace */
+    bool bTraceForOcclusion = true;
+
+    /* Actor ignored by the query and occlusion trace, usually the viewer */
+    const AActor* IgnoredActor = nullptr;
+};
+
+/**
+ * @class UInteractableIndexSubsystem
+ * @brief Uniform grid of every interactable in the world
+ *
+ * Berry bushes, mineable resources and resource field nodes register here when they
+ * begin play, with their IInteractable interface resolved once up front. Interaction
+ * queries only visit the few cells around the viewer, so many concurrent queriers
+ * (players, AI harvesters) can resolve targets without a physics trace each, apart
+ * from an optional single occlusion trace against the best candidate.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UInteractableIndexSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /* Edge length of a grid cell in world units */
+    static constexpr float CellSize = 500.0f;
+
+    /**
+     * @brief Registers an interactable
+     * @param Actor - Actor handling the interaction, must implement IInteractable
+     * @param Location - World space center of the interactable
+     * @param Radius - Bounding radius of the interactable
+     * @param Item - Actor specific item index
+     * @return Handle used to unregister, INDEX_NONE on failure
+     */
+    int32 Register(AActor* Actor, const FVector& Location, float Radius, int32 Item = INDEX_NONE);
+
+    /**
+     * @brief Registers an actor using its component bounds
+     * @param Actor - Actor to register
+     * @return Handle used to unregister, INDEX_NONE on failure
+     */
+    int32 RegisterActor(AActor* Actor);
+
+    /**
+     * @brief Removes an interactable from the index
+     * @param Handle - Handle returned on registration; reset on return
+     */
+    void Unregister(int32& Handle);
+
+    /**
+     * @brief Finds the nearest interactable inside the viewer's cone that has something to offer
+     * @param Query - View and range parameters
+     * @return The interaction target, invalid if none is in view
+     */
+    FInteractionTarget FindInteractable(const FInteractableQuery& Query) const;
+
+    /**
+     * @brief Gets the number of registered interactables
+     * @return Number of entries
+     */
+    int32 GetNumInteractables() const { return Entries.Num(); }
+
+private:
+    /* All registered entries, addressed by handle */
+    TSparseArray<FInteractableEntry> Entries;
+
+    /* Entry handles per grid cell */
+    TMap<FIntVector, TArray<int32>> Cells;
+
+    /* Converts a world location to its grid cell */
+    static FIntVector GetCell(const FVector& Location);
+};
@@ -2,19 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Interactable.h"
 #include "MineableResource.generated.h"
 
-/**
- * @enum EResourceType
- * @brief Defines the various types of resources that can be mined in the game
- */
-UENUM(BlueprintType)
-enum class EResourceType : uint8
-{
-    Wood,   ///< Wood resource type
-    Stone,  ///< Stone resource type
-    Berry   ///< Berry resource type
-};
+class UResourceDefinition;
 
 /**
  * @struct FResourceState
@@ -44,7 +35,7 @@ struct FResourceState
  * and handles the transition between these states as the resource is mined.
  */
 UCLASS(ClassGroup = (Custom), Meta = (BlueprintSpawnableComponent))
-class GAM312SURVIVAL_API AMineableResource : public AActor
+class GAM312SURVIVAL_API AMineableResource : public AActor, public IInteractable
 {
     GENERATED_BODY()
 
@@ -56,6 +47,16 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
     EResourceType ResourceType;
 
+    /* Stamina consumed per unit of resource mined */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mining", Meta = (ClampMin = "0.0"))
+    float StaminaCostPerUnit = 3.0f;
+
+    /* Previews mining the current chunk */
+    virtual FInteractionResult GetInteraction(int32 Item) const override;
+
+    /* Mines the current chunk */
+    virtual FInteractionResult Interact(AActor* Instigator, int32 Item) override;
+
     /**
      * @brief Mines a specific amount from the resource
      * @param AmountToMine - The amount to attempt to mine
@@ -92,10 +93,73 @@ public:
     UFUNCTION(BlueprintPure, Category = "Mining")
     int32 GetRemainingResource() const;
 
+    /**
+     * @brief Gets the configured resource states
+     * @return Array of states from full to depleted, from the definition if one is set
+     */
+    const TArray<FResourceState>& GetResourceStates() const;
+
+    /**
+     * @brief Gets the state index the resource starts in
+     * @return Initial index into the resource states
+     */
+    int32 GetInitialStateIndex() const;
+
+    /**
+     * @brief Finds the state matching a remaining resource amount, through the definition if one is set
+     * @param Remaining - Remaining resource amount
+     * @return Index of the most depleted state still holding the amount, or INDEX_NONE
+     */
+    int32 FindStateIndex(int32 Remaining) const;
+
+    /**
+     * @brief Gets the amount mined by taking a chunk in a state
+     * @param StateIndex - Current state
+     * @param Remaining - Remaining resource amount
+     * @return Amount down to the next state's threshold, 0 in the last state
+     */
+    int32 GetChunkAmount(int32 StateIndex, int32 Remaining) const;
+
+    /**
+     * @brief Gets the time the resource takes to respawn once depleted
+     * @return Respawn delay from the definition if one is set, 0 if it never respawns
+     */
+    float GetRespawnSeconds() const;
+
+    /* Returns the resource to its initial state, called by the respawn scheduler */
+    void Respawn();
+
+    /* Gets the shared state table, if one is set */
+    const UResourceDefinition* GetDefinition() const { return Definition; }
+
+    /**
+     * @brief Gets the current state index
+     * @return Current index into the resource states
+     */
+    int32 GetCurrentStateIndex() const { return CurrentStateIndex; }
+
+    /**
+     * @brief Restores a previously saved state, e.g. when promoting a resource field node
+     * @param StateIndex - State to switch to
+     * @param Remaining - Remaining resource amount within that state
+     */
+    void RestoreState(int32 StateIndex, int32 Remaining);
+
+    /**
+     * @brief Finds the state matching a remaining resource amount
+     * @param States - States from full to depleted
+     * @param Remaining - Remaining resource amount
+     * @return Index of the most depleted state still holding the amount, or INDEX_NONE
+     */
+    static int32 FindStateForAmount(const TArray<FResourceState>& States, int32 Remaining);
+
 protected:
     /* Called when the game starts or when spawned */
     virtual void BeginPlay() override;
 
+    /* Called when the resource is removed from play */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 #if WITH_EDITOR
     /* Handles property changes in the editor */
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -106,26 +170,40 @@ private:
     UPROPERTY(VisibleAnywhere, Category = "Components")
     TObjectPtr<UStaticMeshComponent> ResourceMesh;
 
-    /* Array of possible states for this resource (from full to depleted) */
+    /**
+     * @brief Shared state table of this kind of resource
+     * @tooltip Replaces the legacy per-instance states; resources with a definition always start in its initial state
+     */
     UPROPERTY(EditAnywhere, Category = "Resource Configuration")
+    TObjectPtr<const UResourceDefinition> Definition;
+
+    /* Array of possible states for this resource (from full to depleted), used without a definition */
+    UPROPERTY(EditAnywhere, Category = "Resource Configuration|Legacy", Meta = (EditCondition = "Definition == nullptr"))
     TArray<FResourceState> ResourceStates;
 
-    /* Current state index in the ResourceStates array */
-    UPROPERTY(EditAnywhere, Category = "Resource Configuration", Meta = (ClampMin = "0"))
+    /* Current state index in the resource states */
+    UPROPERTY(EditAnywhere, Category = "Resource Configuration|Legacy", Meta = (ClampMin = "0", EditCondition = "Definition == nullptr"))
     int32 CurrentStateIndex;
 
-    /* Initial state index when the resource spawns */
-    UPROPERTY(EditAnywhere, Category = "Resource Configuration", Meta = (ClampMin = "0"))
+    /* Initial state index when the resource spawns, used without a definition */
+    UPROPERTY(EditAnywhere, Category = "Resource Configuration|Legacy", Meta = (ClampMin = "0", EditCondition = "Definition == nullptr"))
     int32 InitialStateIndex;
 
-    /* Whether to reset to initial state on BeginPlay */
-    UPROPERTY(EditAnywhere, Category = "Resource Configuration")
+    /* Whether to reset to initial state on BeginPlay, used without a definition */
+    UPROPERTY(EditAnywhere, Category = "Resource Configuration|Legacy", Meta = (EditCondition = "Definition == nullptr"))
     bool bResetOnBeginPlay;
 
-    /* Current amount of resource remaining */
-    UPROPERTY(VisibleAnywhere, Category = "Resource State")
+    /* Time a depleted resource takes to return to its initial state, 0 to stay depleted; used without a definition */
+    UPROPERTY(EditAnywhere, Category = "Resource Configuration|Legacy", Meta = (ClampMin = "0.0", Units = "Seconds", EditCondition = "Definition == nullptr"))
+    float RespawnSeconds = 300.0f;
+
+    /* Current amount of resource remaining, derived from the state on BeginPlay so never saved */
+    UPROPERTY(VisibleInstanceOnly, Transient, Category = "Resource State")
     int32 RemainingResource;
 
+    /* Handle of the resource in the interactable index */
+    int32 InteractableHandle = INDEX_NONE;
+
     /* Updates the visual mesh based on current state */
     void UpdateMeshState();
 
@@ -10,8 +10,11 @@ class APlayerCharacter;
 /**
  * @class UObjectivesWidget
  * @brief Displays real-time progress towards game completion objectives. Only contains bare-miminum functionality because I don't have the time to get all fancy.
+ *
+ * The widget does not tick. Objective texts are rebuilt when the player character reports
+ * progress, and the countdown is refreshed by a once per second timer.
  */
-UCLASS()
+UCLASS(Meta = (DisableNativeTick))
 class GAM312SURVIVAL_API UObjectivesWidget : public UUserWidget
 {
     GENERATED_BODY()
@@ -20,8 +23,14 @@ public:
     /* Initializes widget and locates player character reference */
     virtual void NativeConstruct() override;
 
-    /* Updates objective progress every frame */
-    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+    /* Stops the countdown and progress updates */
+    virtual void NativeDestruct() override;
+
+    /**
+     * @brief Starts tracking the objectives of a character
+     * @param Character - Character to track, replaces any previous one
+     */
+    void BindToCharacter(APlayerCharacter* Character);
 
     /* Set the remaining time left in the timer */
     UFUNCTION(BlueprintCallable)
@@ -48,15 +57,32 @@ protected:
     float TimeElapsed;
 
 private:
+    /* Seconds between countdown updates */
+    static constexpr float CountdownInterval = 1.0f;
+
     /* Cached reference to player character */
     TWeakObjectPtr<APlayerCharacter> PlayerCharacter;
 
-    /* Updates all objective display elements */
-    void RefreshObjectiveDisplay();
+    /* Timer driving the countdown */
+    FTimerHandle CountdownTimerHandle;
+
+    /**
+     * @brief Updates the progress texts and checks for a win
+     * @param TotalMaterials - Total materials collected
+     * @param BuildParts - Number of buildables placed
+     */
+    UFUNCTION()
+    void HandleObjectiveProgress(int32 TotalMaterials, int32 BuildParts);
+
+    /* Advances the countdown and checks for a timeout */
+    void UpdateCountdown();
+
+    /* Updates the countdown display element */
+    void RefreshTimeRemaining();
 
     /* Checks and activates end conditions */
-    void CheckEndCondition(float InDeltaTime);
+    void CheckEndCondition();
 
     /* Whether the timeout lose condition has been triggered */
     bool bHasTriggeredTimeout;
-};
\ No newline at end of file
+};
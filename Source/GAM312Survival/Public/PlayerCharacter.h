@@ -6,8 +6,14 @@
 #include "Blueprint/UserWidget.h"
 #include "BuildableBase.h"
 #include "PlayerStatsWidget.h"
+#include "InteractableIndexSubsystem.h"
+#include "SurvivalStatsComponent.h"
+#include "SurvivalDebugOverlay.h"
+#include "WorldCollision.h"
 #include "PlayerCharacter.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnObjectiveProgressChanged, int32, TotalMaterialsCollected, int32, BuildPartsCount);
+
 /**
   * @class APlayerCharacter
   * @brief Main player character class that handles movement, inventory, and survival mechanics
@@ -32,79 +38,58 @@ protected:
     /* Called when the game starts or when spawned */
     virtual void BeginPlay() override;
 
-    // Helper Functions
-
-    /**
-     * @brief Initializes a stat to its proper value
-     * @param CurrentValue - The current value of the stat
-     * @param MaxValue - The maximum allowed value for the stat
-     * @return The properly initialized value
-     */
-    UFUNCTION()
-    float InitializeStat(float CurrentValue, float MaxValue);
-
-    // Player Stats Configuration
+    /* Moves stats saved on the character before they lived in StatsComponent into it */
+    virtual void PostLoad() override;
 
-    /* Maximum health the player can have */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float MaxHealth = 100.0f;
+    // Player Stats
 
-    /* Maximum hunger level */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float MaxHunger = 100.0f;
+    /* Health, hunger and stamina, advanced in batch by the survival stats subsystem */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Player Stats")
+    USurvivalStatsComponent* StatsComponent;
 
-    /* Maximum stamina level */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float MaxStamina = 100.0f;
+    /* Ends the game once the stats component runs out of health */
+    UFUNCTION()
+    void HandleHealthDepleted();
 
-    /* Current health level */
-    UPROPERTY(EditAnywhere, Category = "Player Stats")
-    float CurrentHealth;
+#if WITH_EDITORONLY_DATA
+    // Deprecated Player Stats, loaded from older assets and moved into StatsComponent. Negative while not saved
 
-    /* Current hunger level */
-    UPROPERTY(EditAnywhere, Category = "Player Stats")
-    float CurrentHunger;
+    UPROPERTY()
+    float MaxHealth_DEPRECATED = -1.0f;
 
-    /* Current stamina level */
-    UPROPERTY(EditAnywhere, Category = "Player Stats")
-    float CurrentStamina;
+    UPROPERTY()
+    float MaxHunger_DEPRECATED = -1.0f;
 
-    /* Timer handle for hunger updates */
-    FTimerHandle HungerTimerHandle;
-    /* Timer handle for stamina restoration */
-    FTimerHandle StaminaRestoreTimerHandle;
+    UPROPERTY()
+    float MaxStamina_DEPRECATED = -1.0f;
 
-    /* How quickly hunger decreases (units per update) */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float HungerDecreaseRate = 1.0f;
+    UPROPERTY()
+    float CurrentHealth_DEPRECATED = -1.0f;
 
-    /* How often hunger updates (in seconds) */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float HungerUpdateInterval = 1.0f;
+    UPROPERTY()
+    float CurrentHunger_DEPRECATED = -1.0f;
 
-    /* Damage taken per hunger update when starving */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float StarvationDamageRate = 5.0f;
+    UPROPERTY()
+    float CurrentStamina_DEPRECATED = -1.0f;
 
-    /* How quickly stamina restores (units per second) */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float StaminaRestoreRate = 10.0f;
+    /* Hunger lost per update, not per second */
+    UPROPERTY()
+    float HungerDecreaseRate_DEPRECATED = -1.0f;
 
-    /* How quickly stamina drains (units per second) */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float StaminaDecreaseRate = 15.0f;
+    /* Seconds between hunger updates */
+    UPROPERTY()
+    float HungerUpdateInterval_DEPRECATED = -1.0f;
 
-    /* How often stamina updates (in seconds) */
-    UPROPERTY(EditDefaultsOnly, Category = "Player Stats")
-    float StaminaUpdateInterval = 0.05f;
+    /* Health lost per hunger update while starving, not per second */
+    UPROPERTY()
+    float StarvationDamageRate_DEPRECATED = -1.0f;
 
-    /* Updates hunger and applies starvation damage if needed */
-    UFUNCTION()
-    void UpdateHunger();
+    UPROPERTY()
+    float StaminaRestoreRate_DEPRECATED = -1.0f;
 
-    /* Updates stamina based on whether it's being drained or restored */
-    UFUNCTION()
-    void UpdateStamina();
+    UPROPERTY()
+    float StaminaDecreaseRate_DEPRECATED = -1.0f;
+#endif
 
     // Player Inventory Configuration
 
@@ -130,10 +115,35 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Interaction")
     float InteractionRange = 200.0f;
 
+    /* Whether interaction targets are resolved through the interactable index instead of a line trace */
+    UPROPERTY(EditDefaultsOnly, Category = "Interaction")
+    bool bUseInteractionIndex = true;
+
+    /* Half angle (in degrees) of the view cone used by interaction index queries */
+    UPROPERTY(EditDefaultsOnly, Category = "Interaction", Meta = (ClampMin = "0.0", ClampMax = "89.0"))
+    float InteractionConeAngle = 20.0f;
+
+    /* Whether interaction index results are confirmed with a single occlusion trace */
+    UPROPERTY(EditDefaultsOnly, Category = "Interaction")
+    bool bInteractionOcclusionTrace = true;
+
     /* Performs interaction ray trace and handles results */
     UFUNCTION()
     void CheckInteraction();
 
+    /**
+     * @brief Adds a resource to the inventory
+     * @param ResourceType - Type of resource to add
+     * @param Amount - Amount to add
+     */
+    void AddResource(EResourceType ResourceType, int32 Amount);
+
+    /**
+     * @brief Counts collected materials towards the collection objective
+     * @param Amount - Amount collected
+     */
+    void AddCollectedMaterials(int32 Amount);
+
     // User Interface
 
     /* The widget class to use for the in-game menu */
@@ -177,6 +187,36 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Building")
     UMaterialInterface* PreviewMaterial;
 
+    /* Last trace result the preview was placed from, used to validate its placement */
+    FHitResult PreviewHit;
+
+    /* Whether the preview is placed from asynchronous traces, consuming the previous frame's result */
+    UPROPERTY(EditDefaultsOnly, Category = "Building")
+    bool bAsyncPreviewTrace = true;
+
+    /* Camera movement (in cm) below which the preview is not traced again */
+    UPROPERTY(EditDefaultsOnly, Category = "Building", Meta = (ClampMin = "0.0"))
+    float PreviewCameraMoveThreshold = 1.0f;
+
+    /* Camera rotation (in degrees) below which the preview is not traced again */
+    UPROPERTY(EditDefaultsOnly, Category = "Building", Meta = (ClampMin = "0.0"))
+    float PreviewCameraRotateThreshold = 0.25f;
+
+    /* Pending asynchronous preview trace */
+    FTraceHandle PreviewTraceHandle;
+
+    /* Camera transform the last preview trace was issued from */
+    FTransform PreviewTraceCamera;
+
+    /* Whether the preview must be traced again even if the camera stayed put, e.g. after rotating it */
+    bool bPreviewDirty = true;
+
+    /* Yaw of the preview, applied together with its location */
+    float PreviewYaw = 0.0f;
+
+    /* Preview traces issued since startup */
+    uint32 NumPreviewTraces = 0;
+
     // User Interface
 
     /**
@@ -191,6 +231,11 @@ protected:
     UPROPERTY()
     UPlayerStatsWidget* StatsWidgetInstance;
 
+    // Debug
+
+    /* Debug stats overlay, only exists while shown */
+    TUniquePtr<FSurvivalDebugOverlay> DebugOverlay;
+
 public:
     /* Called every frame */
     virtual void Tick(float DeltaTime) override;
@@ -279,6 +324,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Player Stats")
     float GetMaxStamina() const;
 
+    /* Get the survival stats component */
+    USurvivalStatsComponent* GetStatsComponent() const { return StatsComponent; }
+
+    /* Whether the player is placing a buildable */
+    bool IsBuildingMode() const { return bIsBuildingMode; }
+
+    /* Gets the number of build preview traces issued since startup */
+    uint32 GetNumPreviewTraces() const { return NumPreviewTraces; }
+
+    /**
+     * @brief Resolves the interactable the player is looking at
+     * @return The interaction target, invalid if nothing is in range
+     */
+    FInteractionTarget FindInteractionTarget() const;
+
+    /* Switches between interactable index queries and the line trace, e.g. to compare them in a benchmark */
+    void SetUseInteractionIndex(bool bUseIndex) { bUseInteractionIndex = bUseIndex; }
+
     /* Get current wood count */
     UFUNCTION(BlueprintCallable, Category = "Player Inventory")
     int GetWood() const;
@@ -323,6 +386,10 @@ public:
     UPROPERTY(EditDefaultsOnly, Category = "Debug")
     bool bShowDebugStats = false;
 
+    /* Seconds between debug stats text updates */
+    UPROPERTY(EditDefaultsOnly, Category = "Debug", Meta = (ClampMin = "0.0"))
+    float DebugStatsRefreshInterval = 0.25f;
+
     /* Toggles debug stats display */
     UFUNCTION(BlueprintCallable, Category = "Debug")
     void ToggleDebugStats();
@@ -363,10 +430,13 @@ public:
 
     /**
      * @brief Updates preview buildable position based on camera look
-     * @brief Maintains preview actor at interaction range
+     * @brief Maintains preview actor at interaction range, tracing only when the camera moved
      */
     void UpdatePreview();
 
+    /* Moves the preview to PreviewHit and PreviewYaw, snapped to the structure grid if enabled */
+    void ApplyPreviewHit();
+
     /**
      * @brief Rotates preview buildable 15 degrees left
      * @brief Quick rotation increment for placement adjustments
@@ -398,6 +468,10 @@ public:
     UPROPERTY(VisibleAnywhere, Category = "Objectives")
     int BuildPartsCount = 0;
 
+    /* Broadcast when materials are collected or a buildable is placed */
+    UPROPERTY(BlueprintAssignable, Category = "Objectives")
+    FOnObjectiveProgressChanged OnObjectiveProgressChanged;
+
     // Add these getters under the existing inventory getters
     /**
      * @brief Retrieves total collected materials for objective tracking
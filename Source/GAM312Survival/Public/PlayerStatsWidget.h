@@ -8,15 +8,19 @@
 // Forward declarations
 class UTextBlock;
 class APlayerCharacter;
+class USurvivalStatsComponent;
+enum class ESurvivalStat : uint8;
 
 /**
   * @class UPlayerStatsWidget
   * @brief Widget class that displays real-time player statistics (health, hunger, stamina)
   *
-  * This widget shows formatted numerical values for the player's survival stats
-  * and updates them using native widget tick. Requires binding to text elements in UMG.
+  * This widget shows formatted numerical values for the player's survival stats. It does
+  * not tick; each text is only rebuilt when the stats component publishes a change, so the
+  * layout can be wrapped in an invalidation or retainer box in UMG. Requires binding to
+  * text elements in UMG.
   */
-UCLASS()
+UCLASS(Meta = (DisableNativeTick))
 class GAM312SURVIVAL_API UPlayerStatsWidget : public UUserWidget
 {
     GENERATED_BODY()
@@ -28,12 +32,20 @@ public:
      */
     virtual void NativeConstruct() override;
 
+    /* Stops listening for stat changes */
+    virtual void NativeDestruct() override;
+
+    /**
+     * @brief Starts displaying the stats of a character
+     * @param Character - Character to display, replaces any previous one
+     */
+    void BindToCharacter(APlayerCharacter* Character);
+
     /**
-     * @brief Main update loop for stat values
-     * @param MyGeometry - Widget's geometric data
-     * @param InDeltaTime - Time since last frame
+     * @brief Gets how often a stat text was rebuilt
+     * @return Number of refreshes since the widget was created
      */
-    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+    int32 GetNumRefreshes() const { return NumRefreshes; }
 
     /* Widget displaying and managing objectives */
     UPROPERTY(meta = (BindWidget))
@@ -53,8 +65,20 @@ protected:
     UTextBlock* StaminaValueText;
 
 private:
-    /* Cached reference to player character for stat access */
-    TWeakObjectPtr<APlayerCharacter> PlayerCharacter;
+    /* Stats component of the displayed character */
+    TWeakObjectPtr<USurvivalStatsComponent> StatsComponent;
+
+    /* Number of stat text refreshes */
+    int32 NumRefreshes = 0;
+
+    /**
+     * @brief Updates the text of a single stat
+     * @param Stat - Stat that changed
+     * @param Value - New value
+     * @param MaxValue - Maximum value
+     */
+    UFUNCTION()
+    void HandleStatChanged(ESurvivalStat Stat, float Value, float MaxValue);
 
     /* Formatting helper function */
     FText FormatStatText(float CurrentValue, float MaxValue, const FString& Label) const;
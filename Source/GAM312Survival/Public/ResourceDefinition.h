@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MineableResource.h"
+#include "ResourceDefinition.generated.h"
+
+/**
+ * @class UResourceDefinition
+ * @brief State table shared by every resource of one kind, e.g. all oak trees
+ *
+ * Resources reference a definition instead of carrying their own copy of the states,
+ * so a placed resource only stores the reference. The state thresholds are cached
+ * into a flat array on load, and states are found by binary search over it when the
+ * amounts decrease from state to state, as they should.
+ */
+UCLASS(BlueprintType)
+class GAM312SURVIVAL_API UResourceDefinition : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /* States from full to depleted */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Resource")
+    TArray<FResourceState> States;
+
+    /* State resources start in */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Resource", Meta = (ClampMin = "0"))
+    int32 InitialStateIndex = 0;
+
+    /* Time a depleted resource takes to return to its initial state, 0 to stay depleted */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Resource", Meta = (ClampMin = "0.0", Units = "Seconds"))
+    float RespawnSeconds = 300.0f;
+
+    virtual void PostLoad() override;
+
+#if WITH_EDITOR
+    /* Rebuilds the cached thresholds after edits */
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+    /**
+     * @brief Gets the initial state, clamped to the table
+     * @return Index into States, or INDEX_NONE if there are none
+     */
+    int32 GetInitialStateIndex() const { return States.Num() > 0 ? FMath::Clamp(InitialStateIndex, 0, States.Num() - 1) : INDEX_NONE; }
+
+    /**
+     * @brief Finds the state matching a remaining resource amount
+     * @param Remaining - Remaining resource amount
+     * @return Index of the most depleted state still holding the amount, or INDEX_NONE
+     */
+    int32 FindStateForAmount(int32 Remaining) const;
+
+    /**
+     * @brief Gets the amount mined by taking the current chunk
+     * @param StateIndex - Current state
+     * @param Remaining - Remaining resource amount
+     * @return Amount down to the next state's threshold, 0 in the last state
+     */
+    int32 GetChunkAmount(int32 StateIndex, int32 Remaining) const;
+
+private:
+    /* Amount of each state, a flat copy of States for lookups */
+    TArray<int32> StateThresholds;
+
+    /* Whether the thresholds decrease from state to state, allowing binary search */
+    bool bThresholdsDescending = true;
+
+    /* Rebuilds StateThresholds from States */
+    void CacheThresholds();
+};
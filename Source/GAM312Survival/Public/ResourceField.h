@@ -0,0 +1,181 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MineableResource.h"
+#include "ResourceField.generated.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+
+/**
+ * @struct FResourceFieldNode
+ * @brief Plain data for a single resource node in a resource field
+ */
+struct FResourceFieldNode
+{
+    /* World transform of the node */
+    FTransform Transform;
+
+    /* The amount of resource remaining */
+    int32 RemainingResource = 0;
+
+    /* Current index into the field's resource states */
+    int32 StateIndex = 0;
+
+    /* Index of the node's instance in the HISM of its current state mesh */
+    int32 InstanceIndex = INDEX_NONE;
+
+    /* Mesh the node is currently drawn with, if any */
+    UStaticMesh* StateMesh = nullptr;
+
+    /* Actor the node was promoted to, if any */
+    TWeakObjectPtr<AMineableResource> PromotedActor;
+
+    /* Handle of the node in the interactable index */
+    int32 InteractableHandle = INDEX_NONE;
+};
+
+/**
+ * @struct FResourceFieldBatch
+ * @brief One instanced component per resource state mesh
+ */
+USTRUCT()
+struct FResourceFieldBatch
+{
+    GENERATED_BODY()
+
+    /* Component drawing every node currently in a state using this mesh */
+    UPROPERTY()
+    TObjectPtr<UHierarchicalInstancedStaticMeshComponent> Component = nullptr;
+
+    /* Node index for each instance of the component */
+    TArray<int32> InstanceNodes;
+};
+
+/**
+ * @class AResourceField
+ * @brief Manages a large field of mineable resources without one actor per node
+ *
+ * Nodes are stored as plain structs (type, remaining amount, state index) and each
+ * FResourceState mesh is drawn through one HISM. Instances move between HISMs when a
+ * node changes state. A node is only promoted to a real AMineableResource actor when
+ * something needs one, e.g. when a player interacts with it.
+ */
+UCLASS()
+class GAM312SURVIVAL_API AResourceField : public AActor, public IInteractable
+{
+    GENERATED_BODY()
+
+public:
+    /* Constructor for the ResourceField */
+    AResourceField();
+
+    /**
+     * @brief Resource actor class providing the states and type of every node
+     * @tooltip Also the class spawned when a node is promoted
+     */
+    UPROPERTY(EditAnywhere, Category = "Resource Field")
+    TSubclassOf<AMineableResource> ResourceClass;
+
+    /* Node transforms relative to the field */
+    UPROPERTY(EditAnywhere, Category = "Resource Field", Meta = (MakeEditWidget = "true"))
+    TArray<FTransform> NodeTransforms;
+
+    /**
+     * @brief Gets the type of resource in this field
+     * @return Resource type of the resource class
+     */
+    UFUNCTION(BlueprintPure, Category = "Resource Field")
+    EResourceType GetResourceType() const;
+
+    /**
+     * @brief Mines a node without promoting it to an actor
+     * @param NodeIndex - Node to mine
+     * @param AmountToMine - The amount to attempt to mine
+     * @return The amount of resource mined
+     */
+    UFUNCTION(BlueprintCallable, Category = "Resource Field")
+    int32 MineNode(int32 NodeIndex, int32 AmountToMine);
+
+    /**
+     * @brief Returns a depleted node, or the actor it was promoted to, to the initial state, called by the respawn scheduler
+     * @param NodeIndex - Node to restore
+     */
+    void RespawnNode(int32 NodeIndex);
+
+    /**
+     * @brief Gets the amount of resource in a node's current chunk
+     * @param NodeIndex - Node to query
+     * @return Difference between the node's remaining amount and its next state
+     */
+    UFUNCTION(BlueprintPure, Category = "Resource Field")
+    int32 GetNodeChunkAmount(int32 NodeIndex) const;
+
+    /**
+     * @brief Replaces a node's instance with a real resource actor
+     * @param NodeIndex - Node to promote
+     * @return The resource actor now representing the node
+     */
+    UFUNCTION(BlueprintCallable, Category = "Resource Field")
+    AMineableResource* PromoteNode(int32 NodeIndex);
+
+    /**
+     * @brief Resolves the node behind an instance, e.g. from a trace hit
+     * @param Component - Hit component
+     * @param InstanceIndex - Hit instance (FHitResult::Item)
+     * @return Node index, or INDEX_NONE if the instance does not belong to this field
+     */
+    int32 FindNodeForInstance(const UPrimitiveComponent* Component, int32 InstanceIndex) const;
+
+    /* Previews mining a node's current chunk */
+    virtual FInteractionResult GetInteraction(int32 Item) const override;
+
+    /* Promotes the node and mines its current chunk */
+    virtual FInteractionResult Interact(AActor* Instigator, int32 Item) override;
+
+    /* Resolves the node behind a hit instance */
+    virtual int32 GetItemForHit(const FHitResult& Hit) const override;
+
+    /**
+     * @brief Gets the number of nodes in the field
+     * @return Node count
+     */
+    int32 GetNumNodes() const { return Nodes.Num(); }
+
+protected:
+    /* Called when the game starts or when spawned */
+    virtual void BeginPlay() override;
+
+    /* Removes all nodes from the interactable index */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    /* Root component for transformation */
+    UPROPERTY(VisibleAnywhere, Category = "Components")
+    TObjectPtr<USceneComponent> RootComp;
+
+    /* Instanced components keyed by state mesh */
+    UPROPERTY()
+    TMap<TObjectPtr<UStaticMesh>, FResourceFieldBatch> Batches;
+
+    /* All nodes of the field */
+    TArray<FResourceFieldNode> Nodes;
+
+    /* Gets the states of the resource class */
+    const TArray<FResourceState>& GetStates() const;
+
+    /* Gets the class default of the resource class, or nullptr without one */
+    const AMineableResource* GetResourceDefaults() const;
+
+    /* Finds or creates the batch for a state mesh */
+    FResourceFieldBatch& FindOrAddBatch(UStaticMesh* Mesh);
+
+    /* Adds the node's instance for its current state */
+    void AddNodeInstance(int32 NodeIndex);
+
+    /* Removes the node's instance, if any */
+    void RemoveNodeInstance(int32 NodeIndex);
+
+    /* Applies a new state to a node, moving its instance between batches */
+    void SetNodeState(int32 NodeIndex, int32 NewStateIndex);
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TimingWheel.h"
+#include "ResourceRespawnSubsystem.generated.h"
+
+class AMineableResource;
+class AResourceField;
+
+/**
+ * @struct FPendingResourceRespawn
+ * @brief A depleted resource actor or resource field node waiting to be restored
+ */
+struct FPendingResourceRespawn
+{
+    /* Depleted resource actor */
+    TWeakObjectPtr<AMineableResource> Resource;
+
+    /* Field of a depleted node */
+    TWeakObjectPtr<AResourceField> Field;
+
+    /* Depleted node within Field */
+    int32 NodeIndex = INDEX_NONE;
+};
+
+/**
+ * @class UResourceRespawnSubsystem
+ * @brief Restores depleted mineable resources after their respawn delay
+ *
+ * Depleted resources and resource field nodes are filed into one hierarchical timing
+ * wheel instead of each running a timer or a tick, and everything that became due in a
+ * frame is restored in one batch. Respawn delays run to minutes or hours, so the wheel
+ * has a one second resolution and three levels of 64 slots, spanning about three days;
+ * each pending respawn is moved at most twice before it fires however long its delay.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UResourceRespawnSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /* Whether depleted resources should respawn */
+    static bool IsEnabled();
+
+    virtual void Deinitialize() override;
+
+    /**
+     * @brief Schedules a depleted resource to be restored
+     * @param Resource - Depleted resource; skipped if it is gone by then
+     * @param DelaySeconds - Time until the resource is restored
+     */
+    void ScheduleRespawn(AMineableResource* Resource, float DelaySeconds);
+
+    /**
+     * @brief Schedules a depleted resource field node to be restored
+     * @param Field - Field of the node; skipped if it is gone by then
+     * @param NodeIndex - Depleted node
+     * @param DelaySeconds - Time until the node is restored
+     */
+    void ScheduleRespawn(AResourceField* Field, int32 NodeIndex, float DelaySeconds);
+
+    /**
+     * @brief Gets the number of pending respawns
+     * @return Number of scheduled resources
+     */
+    int32 GetNumScheduled() const { return Wheel.Num(); }
+
+    /* Restores every resource that is due */
+    virtual void Tick(float DeltaTime) override;
+
+    /* Only tick while there is something scheduled */
+    virtual bool IsTickable() const override { return Wheel.Num() > 0; }
+
+    virtual TStatId GetStatId() const override;
+
+private:
+    /* Pending respawns */
+    TTimingWheel<FPendingResourceRespawn> Wheel{ 1.0f, 64, 3 };
+};
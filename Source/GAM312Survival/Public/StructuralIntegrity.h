@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructureGrid.h"
+
+/**
+ * @struct FStructuralIntegritySettings
+ * @brief Stability a part starts with and loses per part it is away from the ground
+ */
+struct FStructuralIntegritySettings
+{
+    /* Stability of parts resting on the ground */
+    int32 MaxStability = 100;
+
+    /* Stability lost by a wall over the part it rests on */
+    int32 WallLoss = 10;
+
+    /* Stability lost by a floor over the part it rests on */
+    int32 FloorLoss = 20;
+
+    /* Stability lost by a slant over the part it rests on */
+    int32 SlantLoss = 15;
+};
+
+/**
+ * @class FStructuralIntegrityGraph
+ * @brief Support graph of placed parts with incrementally maintained stability
+ *
+ * A grounded part has full stability; any other part has the best stability of the
+ * parts it rests on (FStructureGrid::GetSupportSlots) less its own loss. Adding a part
+ * only raises the parts downstream of it. Removing one clears the parts whose stability
+ * came through it and refills them from the supports left around them, the way light is
+ * removed in a voxel world, so an update visits only the affected part of the base.
+ * Parts left without stability collapse together.
+ */
+class GAM312SURVIVAL_API FStructuralIntegrityGraph
+{
+public:
+    explicit FStructuralIntegrityGraph(const FStructuralIntegritySettings& InSettings = FStructuralIntegritySettings());
+
+    /**
+     * @brief Gets the stability a part would have
+     * @param Slot - Socket of the part
+     * @param bGrounded - Whether the part rests on the ground
+     * @return Stability from the ground or the current supports, 0 if unsupported
+     */
+    int32 GetPlacementStability(const FStructureSlot& Slot, bool bGrounded) const;
+
+    /**
+     * @brief Adds a part and raises the stability of the parts it supports
+     * @param Slot - Socket of the part
+     * @param bGrounded - Whether the part rests on the ground
+     * @return Stability of the part
+     */
+    int32 Add(const FStructureSlot& Slot, bool bGrounded);
+
+    /**
+     * @brief Removes a part and collapses the parts left without support
+     * @param Slot - Socket of the part
+     * @param OutCollapsed - Receives the sockets of collapsed parts, already removed from the graph
+     */
+    void Remove(const FStructureSlot& Slot, TArray<FStructureSlot>& OutCollapsed);
+
+    /**
+     * @brief Gets the stability of a part
+     * @param Slot - Socket of the part
+     * @return Stability, or 0 if the socket is empty
+     */
+    int32 GetStability(const FStructureSlot& Slot) const;
+
+    /* Number of parts */
+    int32 Num() const { return Nodes.Num(); }
+
+    /* Number of parts whose stability the last Add or Remove visited */
+    int32 GetNumVisited() const { return NumVisited; }
+
+private:
+    /* Placed part */
+    struct FNode
+    {
+        /* Current stability, 0 while being refilled after a removal */
+        int32 Stability = 0;
+
+        /* Whether the part rests on the ground */
+        bool bGrounded = false;
+    };
+
+    FStructuralIntegritySettings Settings;
+
+    /* Parts by socket */
+    TMap<FStructureSlot, FNode> Nodes;
+
+    /* Parts visited by the last update */
+    int32 NumVisited = 0;
+
+    /* Scratch queues, kept to avoid allocating per update */
+    TArray<TPair<FStructureSlot, int32>> ClearQueue;
+    TArray<FStructureSlot> RaiseQueue;
+    TArray<FStructureSlot> Cleared;
+
+    /* Stability lost by a part over its support */
+    int32 GetLoss(const FStructureSlot& Slot) const;
+
+    /* Raises the parts downstream of the queued parts until nothing changes */
+    void PropagateRaise();
+};
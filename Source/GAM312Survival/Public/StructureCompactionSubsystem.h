@@ -0,0 +1,205 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/SparseArray.h"
+#include "BuildableBase.h"
+#include "StructureCompactionSubsystem.generated.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+class UPrimitiveComponent;
+class UMaterialInterface;
+class UStaticMeshComponent;
+
+/**
+ * @struct FStructureRecord
+ * @brief Plain data kept for a placed structure once its actor is compacted
+ */
+struct FStructureRecord
+{
+    /* Class the structure was placed as, used to restore its actor */
+    TSubclassOf<ABuildableBase> Class;
+
+    /* Structure type */
+    EBuildableType BuildableType = EBuildableType::Wall;
+
+    /* Construction material */
+    EMaterialType MaterialType = EMaterialType::Wooden;
+
+    /* World transform */
+    FTransform Transform;
+
+    /* Remaining health */
+    float Health = 0.0f;
+
+    /* Mesh the structure is drawn with */
+    UStaticMesh* Mesh = nullptr;
+
+    /* Materials overriding the mesh's own, restored on the actor when uncompacted */
+    TArray<UMaterialInterface*> OverrideMaterials;
+
+    /* Cell the structure is batched in */
+    FIntPoint Cell = FIntPoint::ZeroValue;
+
+    /* Index of the batch drawing the structure */
+    int32 Batch = INDEX_NONE;
+
+    /* Index of the structure's instance in its batch */
+    int32 InstanceIndex = INDEX_NONE;
+
+    /* Structure grid socket the structure holds */
+    FStructureSlot GridSlot;
+
+    /* Whether the structure holds GridSlot */
+    bool bOccupiesGridSlot = false;
+};
+
+/**
+ * @struct FStructureBatchKey
+ * @brief What structures must share to be drawn by the same batch
+ */
+struct FStructureBatchKey
+{
+    /* Cell of the structures */
+    FIntPoint Cell = FIntPoint::ZeroValue;
+
+    /* Mesh of the structures */
+    UStaticMesh* Mesh = nullptr;
+
+    /* Override materials of the structures */
+    TArray<UMaterialInterface*> Materials;
+
+    bool operator==(const FStructureBatchKey& Other) const
+    {
+        return Cell == Other.Cell && Mesh == Other.Mesh && Materials == Other.Materials;
+    }
+
+    friend uint32 GetTypeHash(const FStructureBatchKey& Key)
+    {
+        uint32 Hash = HashCombine(GetTypeHash(Key.Cell), GetTypeHash(Key.Mesh));
+        for (const UMaterialInterface* Material : Key.Materials)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Material));
+        }
+        return Hash;
+    }
+};
+
+/**
+ * @struct FStructureBatch
+ * @brief Instanced component drawing every structure of one mesh and set of materials in one cell
+ */
+struct FStructureBatch
+{
+    /* Component drawing the structures, owned by the cell's actor */
+    UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+
+    /* Record handle for each instance of the component */
+    TArray<int32> InstanceRecords;
+};
+
+/**
+ * @class UStructureCompactionSubsystem
+ * @brief Folds placed structures into per-cell instanced meshes
+ *
+ * Once a buildable's placement animation has finished, its actor is replaced by an
+ * instance in the HISM of its mesh in its grid cell (survival.Structures.CellSize) and
+ * returned to the buildable pool. Only a lightweight record is kept for gameplay
+ * queries. A structure can be turned back into an actor for demolition or editing.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UStructureCompactionSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /* Whether placed structures should be compacted */
+    static bool IsEnabled();
+
+    /**
+     * @brief Replaces a placed buildable with an instance and a record
+     * @param Buildable - Placed buildable, released to the buildable pool on success
+     * @return Handle of the structure's record, or INDEX_NONE if it could not be compacted
+     */
+    int32 Compact(ABuildableBase* Buildable);
+
+    /**
+     * @brief Turns a compacted structure back into an actor
+     * @param Handle - Record of the structure, invalid afterwards
+     * @return The restored buildable, or nullptr if the handle is invalid
+     */
+    ABuildableBase* Uncompact(int32 Handle);
+
+    /**
+     * @brief Removes compacted structures for good, e.g. when they collapse
+     * @param Handles - Records of the structures, invalid afterwards
+     */
+    void RemoveRecords(const TArray<int32>& Handles);
+
+    /**
+     * @brief Gets the record of a compacted structure
+     * @param Handle - Record handle
+     * @return The record, or nullptr if the handle is invalid
+     */
+    const FStructureRecord* GetRecord(int32 Handle) const;
+
+    /**
+     * @brief Sets the health of a compacted structure
+     * @param Handle - Record handle
+     * @param Health - New health value
+     */
+    void SetRecordHealth(int32 Handle, float Health);
+
+    /**
+     * @brief Resolves the structure behind an instance, e.g. from a trace hit
+     * @param Component - Hit component
+     * @param InstanceIndex - Hit instance (FHitResult::Item)
+     * @return Record handle, or INDEX_NONE if the instance is not a compacted structure
+     */
+    int32 FindRecordForInstance(const UPrimitiveComponent* Component, int32 InstanceIndex) const;
+
+    /**
+     * @brief Finds compacted structures near a location
+     * @param Center - World location to search around
+     * @param Radius - Search radius
+     * @param OutHandles - Receives the record handles of structures within the radius
+     */
+    void FindRecordsInRadius(const FVector& Center, float Radius, TArray<int32>& OutHandles) const;
+
+    /**
+     * @brief Gets the number of compacted structures
+     * @return Record count
+     */
+    int32 GetNumRecords() const { return Records.Num(); }
+
+private:
+    /* Actor owning the instanced components of each cell */
+    UPROPERTY()
+    TMap<FIntPoint, TObjectPtr<AActor>> CellOwners;
+
+    /* Instanced components, never removed so their indices stay valid */
+    TArray<FStructureBatch> Batches;
+
+    /* Batch of each cell, mesh and set of materials */
+    TMap<FStructureBatchKey, int32> BatchIndices;
+
+    /* Batch of each component, so trace hits resolve without scanning the batches */
+    TMap<const UPrimitiveComponent*, int32> ComponentBatches;
+
+    /* Batches of each cell, so radius queries only visit the cells they overlap */
+    TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> CellBatches;
+
+    /* Records of compacted structures, handles are sparse indices */
+    TSparseArray<FStructureRecord> Records;
+
+    /* Cell containing a world location */
+    static FIntPoint GetCell(const FVector& Location);
+
+    /**
+     * @brief Finds or creates the batch drawing a structure
+     * @param Cell - Cell of the structure
+     * @param Template - Mesh component of the structure, whose mesh, materials and collision the batch takes over
+     * @return Index of the batch
+     */
+    int32 FindOrAddBatch(const FIntPoint& Cell, const UStaticMeshComponent* Template);
+};
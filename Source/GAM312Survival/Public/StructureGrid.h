@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EBuildableType : uint8;
+
+/**
+ * @enum EStructureSlotFace
+ * @brief Part of a grid cell a structure occupies
+ */
+enum class EStructureSlotFace : uint8
+{
+    Floor, ///< Bottom face of the cell
+    WallX, ///< Vertical face on the cell's -X side
+    WallY, ///< Vertical face on the cell's -Y side
+    Slant  ///< Diagonal through the cell
+};
+
+/**
+ * @struct FStructureSlot
+ * @brief One socket of the structure grid, a cell and the face of it a part fills
+ *
+ * Walls are always stored on a cell's -X or -Y face, so the wall between two cells has a
+ * single slot no matter which side it was aimed at from.
+ */
+struct FStructureSlot
+{
+    /* Cell, in grid units */
+    FIntVector Cell = FIntVector::ZeroValue;
+
+    /* Face of the cell */
+    EStructureSlotFace Face = EStructureSlotFace::Floor;
+
+    FStructureSlot() = default;
+    FStructureSlot(const FIntVector& InCell, EStructureSlotFace InFace) : Cell(InCell), Face(InFace) {}
+
+    bool operator==(const FStructureSlot& Other) const { return Cell == Other.Cell && Face == Other.Face; }
+
+    friend uint32 GetTypeHash(const FStructureSlot& Slot)
+    {
+        return HashCombine(GetTypeHash(Slot.Cell), static_cast<uint32>(Slot.Face));
+    }
+};
+
+/* Sockets next to one socket, sized for the most neighbours any face has */
+using FStructureSlotList = TArray<FStructureSlot, TInlineAllocator<13>>;
+
+/**
+ * @class FStructureGrid
+ * @brief Hashed 3D grid of occupied structure sockets
+ *
+ * Snapping, occupancy and support checks are a handful of hash lookups each, so their
+ * cost does not depend on how many parts are placed. Parts are expected to have their
+ * pivot at the bottom center, with walls running along their local X axis.
+ *
+ * Support rules: anything resting on the ground is supported. Floors and slants are
+ * also supported by a wall or slant below one of their edges or by a neighbouring
+ * floor, walls by a floor on either side or a wall below them.
+ */
+class GAM312SURVIVAL_API FStructureGrid
+{
+public:
+    /**
+     * @brief Creates an empty grid
+     * @param InCellSize - Edge length of a cell, the size of a floor tile and the height of a wall
+     */
+    explicit FStructureGrid(float InCellSize);
+
+    /* Edge length of a cell */
+    float GetCellSize() const { return CellSize; }
+
+    /**
+     * @brief Finds the socket a part aimed at a location snaps to
+     * @param Type - Structure type of the part
+     * @param Location - Aimed world location
+     * @return Nearest socket for the type; walls take the nearest vertical face
+     */
+    FStructureSlot FindSnapSlot(EBuildableType Type, const FVector& Location) const;
+
+    /**
+     * @brief Gets the world transform of a part in a socket
+     * @param Slot - Socket of the part
+     * @param Yaw - Desired yaw, snapped to 90 degrees for floors and slants; walls follow their face
+     * @return Transform with the part's pivot on the socket
+     */
+    FTransform GetSlotTransform(const FStructureSlot& Slot, float Yaw) const;
+
+    /**
+     * @brief Checks whether a location lies on the floor level of a socket's cell
+     * @param Slot - Socket to check
+     * @param Location - World location, e.g. where a trace hit the ground
+     * @return True if the location is within snapping distance of the bottom of the cell
+     */
+    bool IsOnFloorLevel(const FStructureSlot& Slot, const FVector& Location) const;
+
+    /**
+     * @brief Checks whether a socket is filled
+     * @param Slot - Socket to check
+     * @return True if a part occupies it
+     */
+    bool IsOccupied(const FStructureSlot& Slot) const { return Occupied.Contains(Slot); }
+
+    /**
+     * @brief Checks whether a part in a socket would be held up
+     * @param Slot - Socket to check
+     * @param bGrounded - Whether the part rests on the ground rather than other parts
+     * @return True if supported by the ground or neighbouring parts
+     */
+    bool IsSupported(const FStructureSlot& Slot, bool bGrounded) const;
+
+    /**
+     * @brief Checks whether a part can be placed in a socket
+     * @param Slot - Socket to check
+     * @param bGrounded - Whether the part rests on the ground rather than other parts
+     * @return True if the socket is free and the part would be supported
+     */
+    bool CanPlace(const FStructureSlot& Slot, bool bGrounded) const { return !IsOccupied(Slot) && IsSupported(Slot, bGrounded); }
+
+    /**
+     * @brief Gets the sockets a part can rest on
+     * @param Slot - Socket of the part
+     * @param OutSlots - Receives the sockets whose parts would support it
+     */
+    static void GetSupportSlots(const FStructureSlot& Slot, FStructureSlotList& OutSlots);
+
+    /**
+     * @brief Gets the sockets of parts that can rest on a part, the inverse of GetSupportSlots
+     * @param Slot - Socket of the part
+     * @param OutSlots - Receives the sockets whose parts it would support
+     */
+    static void GetSupportedSlots(const FStructureSlot& Slot, FStructureSlotList& OutSlots);
+
+    /* Marks a socket as filled */
+    void Occupy(const FStructureSlot& Slot) { Occupied.Add(Slot); }
+
+    /* Marks a socket as free */
+    void Vacate(const FStructureSlot& Slot) { Occupied.Remove(Slot); }
+
+    /* Number of filled sockets */
+    int32 Num() const { return Occupied.Num(); }
+
+private:
+    /* Edge length of a cell */
+    float CellSize;
+
+    /* Filled sockets */
+    TSet<FStructureSlot> Occupied;
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/HitResult.h"
+#include "StructureGrid.h"
+#include "StructuralIntegrity.h"
+#include "StructureGridSubsystem.generated.h"
+
+class ABuildableBase;
+
+/**
+ * @struct FStructureOccupant
+ * @brief What currently represents the structure in a socket
+ */
+struct FStructureOccupant
+{
+    /* Buildable actor, while the structure is not compacted */
+    TWeakObjectPtr<ABuildableBase> Actor;
+
+    /* Compacted structure record, or INDEX_NONE */
+    int32 Record = INDEX_NONE;
+};
+
+/**
+ * @class UStructureGridSubsystem
+ * @brief Tracks which structure sockets of the world are filled and what holds them up
+ *
+ * Build previews snap to the sockets of a grid of survival.Structures.GridSize cells and
+ * are validated against it, so placement needs no physics overlap queries. Buildables
+ * occupy their socket when placed and keep it while compacted; the socket is freed when
+ * the structure is destroyed. Every filled socket is a part of the structural integrity
+ * graph, and parts left without support when one is removed collapse together.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UStructureGridSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UStructureGridSubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    /* Whether build previews should snap to the structure grid */
+    static bool IsEnabled();
+
+    /* Grid of filled sockets */
+    const FStructureGrid& GetGrid() const { return Grid; }
+
+    /* Support graph of the placed parts */
+    const FStructuralIntegrityGraph& GetIntegrity() const { return Integrity; }
+
+    /**
+     * @brief Fills a socket
+     * @param Slot - Socket of a placed structure
+     * @param bGrounded - Whether the structure rests on the ground
+     * @param Occupant - Buildable placed in the socket
+     */
+    void Occupy(const FStructureSlot& Slot, bool bGrounded, ABuildableBase* Occupant);
+
+    /**
+     * @brief Updates what represents the structure in a socket, e.g. when it is compacted
+     * @param Slot - Filled socket
+     * @param Actor - Buildable actor, or nullptr once compacted
+     * @param Record - Compacted structure record, or INDEX_NONE
+     */
+    void SetOccupant(const FStructureSlot& Slot, ABuildableBase* Actor, int32 Record = INDEX_NONE);
+
+    /**
+     * @brief Frees a socket and collapses the structures it was holding up
+     * @param Slot - Socket of a removed structure
+     */
+    void Vacate(const FStructureSlot& Slot);
+
+    /**
+     * @brief Checks whether a trace hit a structure rather than the ground
+     * @param Hit - Trace result
+     * @return True for buildables and compacted structure instances
+     */
+    bool IsStructureHit(const FHitResult& Hit) const;
+
+    /**
+     * @brief Checks whether a part placed from a trace hit would rest on the ground
+     * @param Hit - Trace result the part was placed from
+     * @param Slot - Socket the part snapped to
+     * @return True if the trace hit walkable static world geometry, other than structures and
+     *         interactables, on the floor level of the socket's cell
+     */
+    bool IsGroundHit(const FHitResult& Hit, const FStructureSlot& Slot) const;
+
+private:
+    /* Filled sockets */
+    FStructureGrid Grid;
+
+    /* Support graph of the filled sockets */
+    FStructuralIntegrityGraph Integrity;
+
+    /* What represents the structure in each filled socket */
+    TMap<FStructureSlot, FStructureOccupant> Occupants;
+
+    /* Removes the structures in collapsed sockets, compacted ones in one batch */
+    void Collapse(const TArray<FStructureSlot>& Collapsed);
+};
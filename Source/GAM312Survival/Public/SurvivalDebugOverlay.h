@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PreprocessorHelpers.h"
+
+class APlayerCharacter;
+class APlayerController;
+class UCanvas;
+
+/**
+ * @enum ESurvivalDebugTimer
+ * @brief Project systems timed for the debug overlay
+ */
+enum class ESurvivalDebugTimer : uint8
+{
+    Interaction,
+    BuildPreview,
+    SurvivalStats,
+    BerryRegrowth,
+    ResourceState,
+    Butterflies,
+    Count
+};
+
+/**
+ * @struct FSurvivalDebugTimers
+ * @brief Accumulated CPU time per timed system, only gathered while an overlay is shown
+ */
+struct GAM312SURVIVAL_API FSurvivalDebugTimers
+{
+    static constexpr int32 NumTimers = static_cast<int32>(ESurvivalDebugTimer::Count);
+
+    /* Number of overlays currently reading the timers */
+    static int32 NumListeners;
+
+    /* Cycles spent per system since startup */
+    static uint64 Cycles[NumTimers];
+
+    /* Scopes entered per system since startup */
+    static uint32 Calls[NumTimers];
+
+    /* Display name of a timer */
+    static const TCHAR* GetName(ESurvivalDebugTimer Timer);
+};
+
+/**
+ * @class FScopedSurvivalDebugTimer
+ * @brief Adds the time spent in a scope to a system's debug timer
+ */
+class FScopedSurvivalDebugTimer
+{
+public:
+    explicit FScopedSurvivalDebugTimer(ESurvivalDebugTimer InTimer)
+        : Timer(static_cast<int32>(InTimer))
+        , StartCycles(FSurvivalDebugTimers::NumListeners > 0 ? FPlatformTime::Cycles64() : 0)
+    {
+    }
+
+    ~FScopedSurvivalDebugTimer()
+    {
+        if (StartCycles != 0)
+        {
+            FSurvivalDebugTimers::Cycles[Timer] += FPlatformTime::Cycles64() - StartCycles;
+            ++FSurvivalDebugTimers::Calls[Timer];
+        }
+    }
+
+private:
+    int32 Timer;
+    uint64 StartCycles;
+};
+
+#if !UE_BUILD_SHIPPING
+#define SURVIVAL_DEBUG_TIMER(Timer) FScopedSurvivalDebugTimer ANONYMOUS_VARIABLE(SurvivalDebugTimer)(ESurvivalDebugTimer::Timer)
+#else
+#define SURVIVAL_DEBUG_TIMER(Timer)
+#endif
+
+/**
+ * @class FSurvivalDebugOverlay
+ * @brief Canvas overlay showing a character's stats and the cost of the project's systems
+ *
+ * The overlay draws through the debug draw service instead of on-screen debug messages.
+ * Its lines are strings with reserved capacity that are only rewritten at the refresh
+ * rate, so keeping it open does not allocate every frame. Timings are averaged over each
+ * refresh window.
+ */
+class GAM312SURVIVAL_API FSurvivalDebugOverlay
+{
+public:
+    /**
+     * @brief Starts drawing the overlay
+     * @param InCharacter - Character whose stats are shown
+     * @param InRefreshInterval - Seconds between text updates
+     */
+    FSurvivalDebugOverlay(APlayerCharacter* InCharacter, float InRefreshInterval);
+
+    /* Stops drawing the overlay */
+    ~FSurvivalDebugOverlay();
+
+private:
+    /* Fixed lines: stats, inventory, building, timer header */
+    static constexpr int32 NumFixedLines = 4;
+
+    /* Character whose stats are shown */
+    TWeakObjectPtr<APlayerCharacter> Character;
+
+    /* Handle of the debug draw registration */
+    FDelegateHandle DrawHandle;
+
+    /* Seconds between text updates */
+    float RefreshInterval;
+
+    /* Real time of the last text update */
+    double LastRefreshTime = 0.0;
+
+    /* Frame number of the last text update */
+    uint64 LastRefreshFrame = 0;
+
+    /* Character's preview trace count at the last text update */
+    uint32 LastPreviewTraces = 0;
+
+    /* Timer values at the last text update */
+    uint64 LastCycles[FSurvivalDebugTimers::NumTimers] = {};
+    uint32 LastCalls[FSurvivalDebugTimers::NumTimers] = {};
+
+    /* Text lines, rewritten in place */
+    FString Lines[NumFixedLines + FSurvivalDebugTimers::NumTimers];
+
+    /* Draws the overlay for the character's controller */
+    void Draw(UCanvas* Canvas, APlayerController* PlayerController);
+
+    /* Rewrites the text lines from the current values */
+    void Refresh();
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FSurvivalSimulationClock
+ * @brief Turns frame deltas into simulation steps for the survival systems
+ *
+ * With survival.FixedStepRate set, every clock steps at that rate no matter the frame
+ * rate, so results are reproducible and servers can simulate at a low rate. Frames that
+ * cover several steps catch up with at most survival.MaxSubSteps steps; the rest of the
+ * backlog is dropped. The leftover fraction of a step is exposed as an interpolation
+ * alpha for visuals.
+ *
+ * Without a fixed rate, clocks with a default step accumulate towards that step and
+ * clocks without one step once per frame with the frame delta.
+ */
+struct GAM312SURVIVAL_API FSurvivalSimulationClock
+{
+    /**
+     * @brief Creates a clock
+     * @param InDefaultStepSeconds - Step used when no fixed rate is set, 0 to step every frame
+     * @param bInBoundSubSteps - Whether catching up is limited to survival.MaxSubSteps
+     */
+    explicit FSurvivalSimulationClock(float InDefaultStepSeconds = 0.0f, bool bInBoundSubSteps = true)
+        : DefaultStepSeconds(InDefaultStepSeconds)
+        , bBoundSubSteps(bInBoundSubSteps)
+    {
+    }
+
+    /**
+     * @brief Advances the clock by a frame
+     * @param DeltaTime - Frame delta
+     * @return Number of steps of GetStepSeconds() to simulate this frame
+     */
+    int32 Advance(float DeltaTime);
+
+    /* Length of the steps returned by the last Advance */
+    float GetStepSeconds() const { return StepSeconds; }
+
+    /* Fraction of a step left over after the last Advance, 1 when stepping every frame */
+    float GetAlpha() const { return (!bVariableStep && StepSeconds > 0.0f) ? Accumulator / StepSeconds : 1.0f; }
+
+    /* Time that has not been simulated yet */
+    float GetPendingSeconds() const { return Accumulator; }
+
+    /* Total simulated time */
+    double GetSimulationTime() const { return SimulationTime; }
+
+    /* Whether a fixed simulation rate is set */
+    static bool IsFixedStepEnabled();
+
+private:
+    /* Step used when no fixed rate is set */
+    float DefaultStepSeconds;
+
+    /* Whether catching up is limited */
+    bool bBoundSubSteps;
+
+    /* Whether the last Advance stepped with the frame delta */
+    bool bVariableStep = false;
+
+    /* Current step length */
+    float StepSeconds = 0.0f;
+
+    /* Time not yet simulated */
+    float Accumulator = 0.0f;
+
+    /* Total simulated time */
+    double SimulationTime = 0.0;
+};
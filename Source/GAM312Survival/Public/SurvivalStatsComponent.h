@@ -0,0 +1,182 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SurvivalStatsComponent.generated.h"
+
+class USurvivalStatsSubsystem;
+
+/**
+ * @enum ESurvivalStat
+ * @brief Identifies one of the survival stats
+ */
+UENUM(BlueprintType)
+enum class ESurvivalStat : uint8
+{
+    Health  UMETA(DisplayName = "Health"),
+    Hunger  UMETA(DisplayName = "Hunger"),
+    Stamina UMETA(DisplayName = "Stamina")
+};
+
+/**
+ * @enum ESurvivalRate
+ * @brief Identifies one of the per-second rates the survival stats change at
+ */
+UENUM(BlueprintType)
+enum class ESurvivalRate : uint8
+{
+    HungerDecay       UMETA(DisplayName = "Hunger Decay"),
+    StarvationDamage  UMETA(DisplayName = "Starvation Damage"),
+    StaminaRestore    UMETA(DisplayName = "Stamina Restore"),
+    StaminaDrain      UMETA(DisplayName = "Stamina Drain")
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnHealthDepleted);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSurvivalStatChanged, ESurvivalStat, Stat, float, Value, float, MaxValue);
+
+/**
+ * @class USurvivalStatsComponent
+ * @brief Health, hunger and stamina for any survivor, player or AI
+ *
+ * The component does not tick and holds no live values while playing. Its stats are
+ * stored in USurvivalStatsSubsystem, which advances every survivor in one batched pass.
+ * Rates are expressed per second and applied analytically from the elapsed time.
+ * Listeners are told about changes through OnStatChanged instead of polling.
+ */
+UCLASS(ClassGroup = (Custom), Meta = (BlueprintSpawnableComponent))
+class GAM312SURVIVAL_API USurvivalStatsComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    /* Constructor for the SurvivalStatsComponent */
+    USurvivalStatsComponent();
+
+    // Stats Configuration
+
+    /* Maximum health */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float MaxHealth = 100.0f;
+
+    /* Maximum hunger level */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float MaxHunger = 100.0f;
+
+    /* Maximum stamina level */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float MaxStamina = 100.0f;
+
+    /* Starting health. Values outside (0, MaxHealth] start at MaxHealth */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats")
+    float InitialHealth = 0.0f;
+
+    /* Starting hunger. Values outside (0, MaxHunger] start at MaxHunger */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats")
+    float InitialHunger = 0.0f;
+
+    /* Starting stamina. Values outside (0, MaxStamina] start at MaxStamina */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats")
+    float InitialStamina = 0.0f;
+
+    /* Hunger lost per second */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float HungerDecayRate = 1.0f;
+
+    /* Health lost per second while starving */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float StarvationDamageRate = 5.0f;
+
+    /* Stamina restored per second while not draining */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float StaminaRestoreRate = 10.0f;
+
+    /* Stamina drained per second while draining */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float StaminaDrainRate = 15.0f;
+
+    /* Smallest change that is published through OnStatChanged, 0 to publish every change */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Survival Stats", Meta = (ClampMin = "0.0"))
+    float StatChangeQuantum = 0.1f;
+
+    /* Broadcast when a stat moves to a different multiple of StatChangeQuantum */
+    UPROPERTY(BlueprintAssignable, Category = "Survival Stats")
+    FOnSurvivalStatChanged OnStatChanged;
+
+    /* Broadcast once when health reaches zero */
+    UPROPERTY(BlueprintAssignable, Category = "Survival Stats")
+    FOnHealthDepleted OnHealthDepleted;
+
+    // Stat Access
+
+    /**
+     * @brief Gets the current value of a stat
+     * @param Stat - Stat to query
+     * @return Current value
+     */
+    UFUNCTION(BlueprintPure, Category = "Survival Stats")
+    float GetStat(ESurvivalStat Stat) const;
+
+    /**
+     * @brief Gets the maximum value of a stat
+     * @param Stat - Stat to query
+     * @return Maximum value
+     */
+    UFUNCTION(BlueprintPure, Category = "Survival Stats")
+    float GetMaxStat(ESurvivalStat Stat) const;
+
+    /**
+     * @brief Sets a stat, clamped to its valid range
+     * @param Stat - Stat to change
+     * @param NewValue - Requested value
+     */
+    UFUNCTION(BlueprintCallable, Category = "Survival Stats")
+    void SetStat(ESurvivalStat Stat, float NewValue);
+
+    /**
+     * @brief Sets a rate, applied from the next pass while playing
+     * @param Rate - Rate to change
+     * @param NewValue - Requested value per second, at least zero
+     */
+    UFUNCTION(BlueprintCallable, Category = "Survival Stats")
+    void SetRate(ESurvivalRate Rate, float NewValue);
+
+    /**
+     * @brief Sets whether stamina is draining or restoring
+     * @param bDraining - True to drain stamina
+     */
+    UFUNCTION(BlueprintCallable, Category = "Survival Stats")
+    void SetStaminaDraining(bool bDraining);
+
+    /**
+     * @brief Gets whether stamina is draining
+     * @return True while draining
+     */
+    UFUNCTION(BlueprintPure, Category = "Survival Stats")
+    bool IsStaminaDraining() const { return bStaminaDraining; }
+
+    /* Slot of this component in the stats subsystem, INDEX_NONE while not registered */
+    int32 StatsSlot = INDEX_NONE;
+
+    /* Initial value of a stat, after validation against its maximum */
+    float GetInitialStat(ESurvivalStat Stat) const;
+
+protected:
+    /* Registers the stats with the subsystem */
+    virtual void BeginPlay() override;
+
+    /* Removes the stats from the subsystem */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+    /* Applies rates edited while playing */
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+    /* Whether stamina is draining */
+    bool bStaminaDraining = false;
+
+    /* Subsystem holding the live stats */
+    UPROPERTY()
+    TObjectPtr<USurvivalStatsSubsystem> StatsSubsystem;
+};
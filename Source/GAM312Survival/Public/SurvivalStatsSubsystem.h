@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SurvivalStatsComponent.h"
+#include "SurvivalSimulationClock.h"
+#include "SurvivalStatsSubsystem.generated.h"
+
+/**
+ * @class USurvivalStatsSubsystem
+ * @brief Stores and advances the survival stats of every survivor in the world
+ *
+ * Stats live in structure-of-arrays form, one array per value, indexed by the slot of
+ * each USurvivalStatsComponent. All survivors are advanced together once per fixed step
+ * in one loop without early outs or appends. Decay is applied analytically from the elapsed time, so the
+ * results do not depend on how often the pass runs. Changes are published to the owning
+ * components only when a value crosses to another multiple of its change quantum.
+ */
+UCLASS()
+class GAM312SURVIVAL_API USurvivalStatsSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Adds a survivor
+     * @param Component - Component providing the configuration; its slot is set on return
+     */
+    void AddSurvivor(USurvivalStatsComponent* Component);
+
+    /**
+     * @brief Removes a survivor
+     * @param Component - Component to remove; its slot is reset on return
+     */
+    void RemoveSurvivor(USurvivalStatsComponent* Component);
+
+    /**
+     * @brief Gets the current value of a stat
+     * @param Slot - Survivor slot
+     * @param Stat - Stat to query
+     * @return Current value
+     */
+    float GetValue(int32 Slot, ESurvivalStat Stat) const;
+
+    /**
+     * @brief Sets a stat, clamped to its valid range
+     * @param Slot - Survivor slot
+     * @param Stat - Stat to change
+     * @param NewValue - Requested value
+     */
+    void SetValue(int32 Slot, ESurvivalStat Stat, float NewValue);
+
+    /**
+     * @brief Copies a survivor's rates from its component again, after they were changed
+     * @param Slot - Survivor slot
+     */
+    void UpdateRates(int32 Slot);
+
+    /**
+     * @brief Sets whether a survivor's stamina is draining
+     * @param Slot - Survivor slot
+     * @param bDraining - True to drain stamina
+     */
+    void SetStaminaDraining(int32 Slot, bool bDraining);
+
+    /**
+     * @brief Advances every survivor by an amount of time
+     * @param ElapsedSeconds - Time to apply
+     */
+    void AdvanceAll(float ElapsedSeconds);
+
+    /**
+     * @brief Gets the number of registered survivors
+     * @return Survivor count
+     */
+    int32 GetNumSurvivors() const { return Owners.Num(); }
+
+    /* Accumulates time and runs the batched pass once per whole step */
+    virtual void Tick(float DeltaTime) override;
+
+    /* Only tick while there are survivors */
+    virtual bool IsTickable() const override { return Owners.Num() > 0; }
+
+    virtual TStatId GetStatId() const override;
+
+private:
+    /* Component owning each slot */
+    TArray<USurvivalStatsComponent*> Owners;
+
+    // Current values
+    TArray<float> Health;
+    TArray<float> Hunger;
+    TArray<float> Stamina;
+
+    // Limits
+    TArray<float> MaxHealth;
+    TArray<float> MaxHunger;
+    TArray<float> MaxStamina;
+
+    // Rates (per second)
+    TArray<float> HungerDecayRate;
+    TArray<float> StarvationDamageRate;
+    TArray<float> StaminaRate;
+    TArray<float> StaminaRestoreRate;
+    TArray<float> StaminaDrainRate;
+
+    // Change publishing
+    TArray<float> StatQuantum;
+    TArray<float> PublishedHealth;
+    TArray<float> PublishedHunger;
+    TArray<float> PublishedStamina;
+
+    /* Whether each survivor's health ran out during the current pass, reused between passes */
+    TArray<uint8> DepletedMask;
+
+    /* Steps the pass every 0.1 s or at the fixed rate, unbounded since the pass is exact */
+    FSurvivalSimulationClock Clock{ 0.1f, false };
+
+    /* Gets the value array for a stat */
+    TArray<float>& GetValues(ESurvivalStat Stat);
+    const TArray<float>& GetValues(ESurvivalStat Stat) const;
+
+    /* Gets the limit array for a stat */
+    const TArray<float>& GetMaxValues(ESurvivalStat Stat) const;
+
+    /* Gets the last published value array for a stat */
+    TArray<float>& GetPublishedValues(ESurvivalStat Stat);
+
+    /* Rounds a value to a multiple of the quantum, or returns it unchanged for a zero quantum */
+    static float Quantize(float Value, float Quantum);
+
+    /**
+     * @brief Records the published value of a stat if it moved to another quantum
+     * @param Slot - Survivor slot
+     * @param Stat - Stat to check
+     * @return True if listeners should be notified
+     */
+    bool UpdatePublished(int32 Slot, ESurvivalStat Stat);
+
+    /* Notifies the owners of every stat that changed during a batched pass */
+    void PublishChanges();
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class TTimingWheel
+ * @brief Bucketed timer queue that fires everything due in a frame as one batch
+ *
+ * Time is split into ticks of SlotSeconds, and each element is filed into the slot of
+ * the tick it is due on, so scheduling is O(1) and advancing only visits the slots of
+ * the ticks that passed. Elements cannot be cancelled; store weak references and skip
+ * stale ones when they fire.
+ *
+ * With more than one level the wheel is hierarchical: each level's slots span a full
+ * turn of the level below, and a slot is cascaded into the lower levels when the level
+ * below wraps around, so every element is moved at most once per level however long
+ * its delay. With a single level, delays longer than the wheel span stay in their slot
+ * for further turns.
+ */
+template <typename ElementType>
+class TTimingWheel
+{
+public:
+    /**
+     * @brief Creates a wheel
+     * @param InSlotSeconds - Resolution of the wheel, elements fire on the first tick at or after they are due
+     * @param InNumSlots - Number of slots per level, rounded up to a power of two
+     * @param InNumLevels - Number of levels, each spanning NumSlots times the one below
+     */
+    explicit TTimingWheel(float InSlotSeconds = 0.1f, int32 InNumSlots = 64, int32 InNumLevels = 1)
+        : SlotSeconds(FMath::Max(InSlotSeconds, UE_KINDA_SMALL_NUMBER))
+    {
+        const uint32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(InNumSlots, 1));
+        SlotMask = NumSlots - 1;
+        SlotBits = FMath::FloorLog2(NumSlots);
+
+        // Levels past the 64-bit tick range could never be reached
+        const int32 MaxLevels = SlotBits > 0 ? 63 / SlotBits : 1;
+        Levels.SetNum(FMath::Clamp(InNumLevels, 1, MaxLevels));
+        for (TArray<TArray<FEntry>>& Level : Levels)
+        {
+            Level.SetNum(NumSlots);
+        }
+    }
+
+    /**
+     * @brief Schedules an element
+     * @param Element - Element to fire
+     * @param DelaySeconds - Time from now until the element is due
+     */
+    void Schedule(const ElementType& Element, float DelaySeconds)
+    {
+        // Count from the start of the current tick, at least one tick ahead
+        const uint64 Ticks = FMath::Max<int64>(FMath::CeilToInt64((FMath::Max(DelaySeconds, 0.0f) + Accumulator) / SlotSeconds), 1);
+
+        Insert({ CurrentTick + Ticks, Element });
+        ++NumElements;
+    }
+
+    /**
+     * @brief Advances the wheel and fires every element that became due
+     * @param DeltaSeconds - Time passed
+     * @param OnDue - Called once per due element, after all slots were visited; may schedule again
+     * @return Number of elements fired
+     */
+    template <typename FuncType>
+    int32 Advance(float DeltaSeconds, FuncType&& OnDue)
+    {
+        Accumulator += DeltaSeconds;
+        while (Accumulator >= SlotSeconds)
+        {
+            Accumulator -= SlotSeconds;
+            ++CurrentTick;
+
+            // Higher levels hand their slot down whenever the level below them wraps around
+            for (int32 LevelIndex = Levels.Num() - 1; LevelIndex > 0; --LevelIndex)
+            {
+                const uint32 Shift = SlotBits * LevelIndex;
+                if ((CurrentTick & ((uint64(1) << Shift) - 1)) != 0) continue;
+
+                Swap(Levels[LevelIndex][(CurrentTick >> Shift) & SlotMask], Cascading);
+                for (FEntry& Entry : Cascading)
+                {
+                    Insert(MoveTemp(Entry));
+                }
+                Cascading.Reset();
+            }
+
+            // Elements a full turn or more ahead stay where they are
+            TArray<FEntry>& Slot = Levels[0][CurrentTick & SlotMask];
+            for (int32 i = Slot.Num() - 1; i >= 0; --i)
+            {
+                if (Slot[i].DueTick <= CurrentTick)
+                {
+                    Due.Add(MoveTemp(Slot[i].Element));
+                    Slot.RemoveAtSwap(i, 1, EAllowShrinking::No);
+                }
+            }
+        }
+
+        const int32 NumDue = Due.Num();
+        NumElements -= NumDue;
+
+        for (ElementType& Element : Due)
+        {
+            OnDue(Element);
+        }
+        Due.Reset();
+
+        return NumDue;
+    }
+
+    /* Number of scheduled elements */
+    int32 Num() const { return NumElements; }
+
+private:
+    struct FEntry
+    {
+        /* Tick the element is due on */
+        uint64 DueTick;
+
+        /* Scheduled element */
+        ElementType Element;
+    };
+
+    /* Length of one tick */
+    float SlotSeconds;
+
+    /* Time into the current tick */
+    float Accumulator = 0.0f;
+
+    /* Ticks passed since the wheel was created */
+    uint64 CurrentTick = 0;
+
+    /* Number of scheduled elements */
+    int32 NumElements = 0;
+
+    /* Slot count minus one, the slot count being a power of two */
+    uint32 SlotMask = 0;
+
+    /* Bits of the tick each level covers */
+    uint32 SlotBits = 0;
+
+    /* Elements per slot per level, indexed by due tick shifted down to the level */
+    TArray<TArray<TArray<FEntry>>> Levels;
+
+    /* Entries of the slot being cascaded, reused between cascades */
+    TArray<FEntry> Cascading;
+
+    /* Elements fired by the current advance, reused between advances */
+    TArray<ElementType> Due;
+
+    /* Files an entry into the lowest level whose span covers its delay */
+    void Insert(FEntry&& Entry)
+    {
+        if (Entry.DueTick <= CurrentTick)
+        {
+            Due.Add(MoveTemp(Entry.Element));
+            return;
+        }
+
+        const uint64 Delta = Entry.DueTick - CurrentTick;
+        int32 LevelIndex = 0;
+        while (LevelIndex < Levels.Num() - 1 && Delta >= (uint64(1) << (SlotBits * (LevelIndex + 1))))
+        {
+            ++LevelIndex;
+        }
+        Levels[LevelIndex][(Entry.DueTick >> (SlotBits * LevelIndex)) & SlotMask].Add(MoveTemp(Entry));
+    }
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Math/RandomStream.h"
+#include "TimingWheel.h"
+#include "WanderSchedulerSubsystem.generated.h"
+
+class AButterflyWander;
+
+/**
+ * @class UWanderSchedulerSubsystem
+ * @brief Schedules butterfly retargeting on one shared timing wheel
+ *
+ * Replaces a timer manager timer per butterfly, which was re-armed with a new random
+ * interval on every retarget. Due retargets are processed together once per frame, and
+ * wander targets are drawn from the scheduler's own random stream.
+ */
+UCLASS()
+class GAM312SURVIVAL_API UWanderSchedulerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /* Whether butterflies should retarget through the scheduler instead of their own timers */
+    static bool IsEnabled();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    /**
+     * @brief Schedules the next retarget of a butterfly
+     * @param Butterfly - Butterfly to retarget; skipped if it is gone by then
+     * @param DelaySeconds - Time until the retarget
+     */
+    void ScheduleRetarget(AButterflyWander* Butterfly, float DelaySeconds);
+
+    /**
+     * @brief Gets the stream wander targets are drawn from
+     * @return Random stream of the scheduler
+     */
+    FRandomStream& GetRandomStream() { return Random; }
+
+    /**
+     * @brief Gets the number of pending retargets
+     * @return Number of scheduled butterflies
+     */
+    int32 GetNumScheduled() const { return Wheel.Num(); }
+
+    /* Retargets every butterfly that is due */
+    virtual void Tick(float DeltaTime) override;
+
+    /* Only tick while there is something scheduled */
+    virtual bool IsTickable() const override { return Wheel.Num() > 0; }
+
+    virtual TStatId GetStatId() const override;
+
+private:
+    /* Pending retargets, wander intervals are a few seconds so a tenth of a second is plenty */
+    TTimingWheel<TWeakObjectPtr<AButterflyWander>> Wheel{ 0.1f, 64 };
+
+    /* Source of wander targets and intervals */
+    FRandomStream Random;
+};
@@ -0,0 +1,8 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GAM312SurvivalTests.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(LogGAM312SurvivalTests);
+
+IMPLEMENT_MODULE( FDefaultModuleImpl, GAM312SurvivalTests );
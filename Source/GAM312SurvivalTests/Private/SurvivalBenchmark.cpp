@@ -0,0 +1,1291 @@
+#include "SurvivalBenchmark.h"
+#include "GAM312SurvivalTests.h"
+#include "BerryBush.h"
+#include "MineableResource.h"
+#include "ResourceDefinition.h"
+#include "ButterflyWander.h"
+#include "ButterflySwarm.h"
+#include "BuildableBase.h"
+#include "BuildablePoolSubsystem.h"
+#include "PlayerCharacter.h"
+#include "SurvivalStatsComponent.h"
+#include "SurvivalStatsSubsystem.h"
+#include "Interactable.h"
+#include "StructureGrid.h"
+#include "StructuralIntegrity.h"
+#include "TimingWheel.h"
+#include "WanderSchedulerSubsystem.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Containers/Ticker.h"
+#include "Misc/App.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Components/PrimitiveComponent.h"
+#include "UObject/UObjectIterator.h"
+
+TUniquePtr<FSurvivalBenchmark> FSurvivalBenchmark::Active;
+
+namespace SurvivalBenchmark
+{
+    /* Config section holding the classes and thresholds */
+    const TCHAR* ConfigSection = TEXT("SurvivalBenchmark");
+
+    /* Distance between spawned actors */
+    constexpr float GridSpacing = 300.0f;
+
+    /* Resolves a population class from config, falling back to the native class */
+    template <typename T>
+    UClass* GetPopulationClass(const TCHAR* Key)
+    {
+        FString ClassPath;
+        if (GConfig->GetString(ConfigSection, Key, ClassPath, GGameIni) && !ClassPath.IsEmpty())
+        {
+            if (UClass* LoadedClass = TSoftClassPtr<T>(FSoftObjectPath(ClassPath)).LoadSynchronous())
+            {
+                return LoadedClass;
+            }
+        }
+        return T::StaticClass();
+    }
+
+    /* Positive integer argument of a benchmark command, or its default when missing */
+    int32 GetCountArg(const TArray<FString>& Args, int32 Index, int32 Default)
+    {
+        return Args.IsValidIndex(Index) ? FMath::Max(FCString::Atoi(*Args[Index]), 1) : Default;
+    }
+
+    /* Whether a flag was passed to a benchmark command */
+    bool HasFlagArg(const TArray<FString>& Args, const TCHAR* Flag)
+    {
+        return Args.ContainsByPredicate([Flag](const FString& Arg) { return Arg.Equals(Flag, ESearchCase::IgnoreCase); });
+    }
+
+    /* Milliseconds since a cycle count was read */
+    float GetMillisecondsSince(uint64 StartCycles)
+    {
+        return static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+    }
+
+    /* Value at a percentile of sorted samples */
+    float GetPercentile(const TArray<float>& SortedSamples, float Percentile)
+    {
+        if (SortedSamples.Num() == 0) return 0.0f;
+
+        const int32 Index = FMath::Clamp(FMath::FloorToInt(Percentile * (SortedSamples.Num() - 1)), 0, SortedSamples.Num() - 1);
+        return SortedSamples[Index];
+    }
+
+    /* Median of unsorted samples */
+    float GetMedian(TArray<float> Samples)
+    {
+        Samples.Sort();
+        return GetPercentile(Samples, 0.5f);
+    }
+
+    /* Whether a system's cost grows with the spawned populations, so its threshold is per unit of scale */
+    bool ScalesWithPopulation(ESurvivalDebugTimer Timer)
+    {
+        switch (Timer)
+        {
+        case ESurvivalDebugTimer::BerryRegrowth:
+        case ESurvivalDebugTimer::ResourceState:
+        case ESurvivalDebugTimer::Butterflies:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * @struct FReport
+     * @brief CSV report of one benchmark run and whether it met its thresholds
+     *
+     * Summary values are appended to Csv directly, timing rows through AddRow, which
+     * starts the timing table on first use and checks each row against its
+     * MaxP95Ms_<Name> threshold.
+     */
+    struct FReport
+    {
+        /* Report contents */
+        FString Csv;
+
+        /* Whether every threshold was met so far */
+        bool bPassed = true;
+
+        /**
+         * @brief Adds a timing row and checks it against its threshold
+         * @param Name - System name, the threshold key is the name without spaces
+         * @param Samples - Samples in milliseconds
+         * @param Scale - Multiplier of the threshold, for systems whose cost grows with the populations
+         */
+        void AddRow(const FString& Name, TArray<float> Samples, int32 Scale = 1)
+        {
+            if (!bHasRows)
+            {
+                Csv.Append(TEXT("System,P50Ms,P95Ms,P99Ms,MaxMs,MaxP95Ms,Passed\n"));
+                bHasRows = true;
+            }
+
+            Samples.Sort();
+            const float P95 = GetPercentile(Samples, 0.95f);
+
+            // Thresholds of scaled rows are stored per unit of scale
+            float MaxP95 = 0.0f;
+            const FString Key = TEXT("MaxP95Ms_") + Name.Replace(TEXT(" "), TEXT(""));
+            const bool bHasThreshold = GConfig->GetFloat(ConfigSection, *Key, MaxP95, GGameIni) && MaxP95 > 0.0f;
+            MaxP95 *= Scale;
+            const bool bRowPassed = !bHasThreshold || P95 <= MaxP95;
+
+            Csv.Appendf(TEXT("%s,%.4f,%.4f,%.4f,%.4f,%s,%s\n"),
+                *Name,
+                GetPercentile(Samples, 0.5f),
+                P95,
+                GetPercentile(Samples, 0.99f),
+                Samples.Num() > 0 ? Samples.Last() : 0.0f,
+                bHasThreshold ? *FString::Printf(TEXT("%.4f"), MaxP95) : TEXT(""),
+                bRowPassed ? TEXT("true") : TEXT("false"));
+
+            if (!bRowPassed)
+            {
+                UE_LOG(LogGAM312SurvivalTests, Error, TEXT("Benchmark regression: %s p95 %.4f ms exceeds %.4f ms"), *Name, P95, MaxP95);
+                bPassed = false;
+            }
+        }
+
+        /**
+         * @brief Checks that a cost stayed flat as its population grew, against Max<Name>CostGrowth
+         * @param Name - Measured cost, e.g. Snap
+         * @param SmallestP50 - Median cost at the smallest population
+         * @param LargestP50 - Median cost at the largest population
+         * @param Range - Populations compared, for the log
+         */
+        void CheckCostGrowth(const TCHAR* Name, float SmallestP50, float LargestP50, const FString& Range)
+        {
+            float MaxGrowth = 0.0f;
+            const FString Key = FString::Printf(TEXT("Max%sCostGrowth"), Name);
+            const bool bHasThreshold = GConfig->GetFloat(ConfigSection, *Key, MaxGrowth, GGameIni) && MaxGrowth > 0.0f;
+            const float Growth = SmallestP50 > 0.0f ? LargestP50 / SmallestP50 : 1.0f;
+            if (bHasThreshold && Growth > MaxGrowth)
+            {
+                UE_LOG(LogGAM312SurvivalTests, Error, TEXT("Benchmark regression: %s cost grew %.2fx %s, over %.2fx"), Name, Growth, *Range, MaxGrowth);
+                bPassed = false;
+            }
+            Csv.Appendf(TEXT("\n%sCostGrowth,%.4f\n%s,%s\n"),
+                Name,
+                Growth,
+                *Key,
+                bHasThreshold ? *FString::Printf(TEXT("%.4f"), MaxGrowth) : TEXT(""));
+        }
+
+        /**
+         * @brief Writes the report to the profiling directory and logs the outcome
+         * @param Label - Benchmark name for the log
+         * @param FileName - Report name, dated in the written file
+         * @return Whether every threshold was met
+         */
+        bool Save(const TCHAR* Label, const FString& FileName) const
+        {
+            const FString ReportPath = FPaths::Combine(
+                FPaths::ProfilingDir(),
+                TEXT("SurvivalBenchmark"),
+                FString::Printf(TEXT("SurvivalBenchmark_%s_%s.csv"), *FileName, *FDateTime::Now().ToString())
+            );
+            FFileHelper::SaveStringToFile(Csv, *ReportPath);
+
+            UE_LOG(LogGAM312SurvivalTests, Display, TEXT("%s benchmark %s, report written to %s"),
+                Label, bPassed ? TEXT("passed") : TEXT("failed"), *ReportPath);
+            return bPassed;
+        }
+
+    private:
+        /* Whether the timing table was started */
+        bool bHasRows = false;
+    };
+
+    /**
+     * @class FBenchmarkCommand
+     * @brief Console command that runs one benchmark to completion and reports its result
+     *
+     * Unattended runs exit with a non-zero code when the benchmark failed, so the command
+     * can gate a headless run.
+     */
+    class FBenchmarkCommand
+    {
+    public:
+        /* Runs the benchmark with the command arguments and returns whether it passed */
+        using FRunFunction = TFunction<bool(const TArray<FString>& Args, UWorld* World)>;
+
+        /**
+         * @brief Registers the command
+         * @param Name - Console command
+         * @param Help - Description and usage
+         * @param bNeedsGameWorld - Whether the benchmark spawns actors, and so only runs in a game world
+         * @param Run - The benchmark
+         */
+        FBenchmarkCommand(const TCHAR* Name, const TCHAR* Help, bool bNeedsGameWorld, FRunFunction Run)
+            : Command(Name, Help, FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+                [bNeedsGameWorld, Run = MoveTemp(Run)](const TArray<FString>& Args, UWorld* World)
+                {
+                    if (bNeedsGameWorld && (!World || !World->IsGameWorld())) return;
+
+                    const bool bPassed = Run(Args, World);
+                    if (FApp::IsUnattended())
+                    {
+                        FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+                    }
+                }))
+        {
+        }
+
+    private:
+        FAutoConsoleCommandWithWorldAndArgs Command;
+    };
+
+    /* Appends the registered primitive and render proxy counts and checks them against their threshold */
+    void AddPrimitiveCounts(FReport& Report, const UWorld* World, int32 Scale)
+    {
+        int32 NumPrimitives = 0;
+        int32 NumProxies = 0;
+        for (TObjectIterator<UPrimitiveComponent> It; It; ++It)
+        {
+            if (It->GetWorld() != World || !It->IsRegistered()) continue;
+
+            ++NumPrimitives;
+            if (It->SceneProxy)
+            {
+                ++NumProxies;
+            }
+        }
+
+        // Per unit of scale, so batched populations keep the count flat as they grow
+        int32 MaxPrimitives = 0;
+        const bool bHasThreshold = GConfig->GetInt(ConfigSection, TEXT("MaxPrimitivesPerScale"), MaxPrimitives, GGameIni) && MaxPrimitives > 0;
+        MaxPrimitives *= Scale;
+
+        Report.Csv.Appendf(TEXT("Primitives,%d\nSceneProxies,%d\nMaxPrimitives,%s\n\n"),
+            NumPrimitives,
+            NumProxies,
+            bHasThreshold ? *FString::FromInt(MaxPrimitives) : TEXT(""));
+
+        if (bHasThreshold && NumPrimitives > MaxPrimitives)
+        {
+            UE_LOG(LogGAM312SurvivalTests, Error, TEXT("Benchmark regression: %d primitives exceed %d"), NumPrimitives, MaxPrimitives);
+            Report.bPassed = false;
+        }
+    }
+
+    /* Times placing buildables by spawning them and by acquiring them from the pool */
+    bool RunPlacementBenchmark(UWorld* World, int32 Count)
+    {
+        UBuildablePoolSubsystem* BuildablePool = World->GetSubsystem<UBuildablePoolSubsystem>();
+        if (!BuildablePool || !UBuildablePoolSubsystem::IsEnabled())
+        {
+            UE_LOG(LogGAM312SurvivalTests, Warning, TEXT("Placement benchmark needs the buildable pool, see survival.BuildablePool.Enabled"));
+            return false;
+        }
+
+        TSubclassOf<ABuildableBase> Class = GetPopulationClass<ABuildableBase>(TEXT("BuildableClass"));
+        const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+        auto GetTransform = [Side](int32 i)
+        {
+            return FTransform(FVector((i % Side) * GridSpacing, (i / Side) * GridSpacing, 0.0f));
+        };
+
+        TArray<float> SpawnedSamples;
+        TArray<float> PooledSamples;
+        SpawnedSamples.Reserve(Count);
+        PooledSamples.Reserve(Count);
+        TArray<ABuildableBase*> Placed;
+        Placed.Reserve(Count);
+
+        // Without pooling, every placement is a full spawn
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            ABuildableBase* Buildable = World->SpawnActor<ABuildableBase>(Class, GetTransform(i), SpawnParams);
+            SpawnedSamples.Add(GetMillisecondsSince(StartCycles));
+            Placed.Add(Buildable);
+        }
+        for (ABuildableBase* Buildable : Placed)
+        {
+            if (Buildable) Buildable->Destroy();
+        }
+        Placed.Reset();
+
+        // Fill the pool up front, as pre-warming does while building
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Placed.Add(BuildablePool->Acquire(Class, GetTransform(i), ESpawnActorCollisionHandlingMethod::AlwaysSpawn));
+        }
+        for (ABuildableBase* Buildable : Placed)
+        {
+            BuildablePool->Release(Buildable);
+        }
+        Placed.Reset();
+
+        for (int32 i = 0; i < Count; ++i)
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            ABuildableBase* Buildable = BuildablePool->Acquire(Class, GetTransform(i), ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+            PooledSamples.Add(GetMillisecondsSince(StartCycles));
+            Placed.Add(Buildable);
+        }
+        for (ABuildableBase* Buildable : Placed)
+        {
+            BuildablePool->Release(Buildable);
+        }
+
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Placements,%d\n\n"), Count);
+        Report.AddRow(TEXT("Placement Spawned"), MoveTemp(SpawnedSamples));
+        Report.AddRow(TEXT("Placement Pooled"), MoveTemp(PooledSamples));
+        return Report.Save(TEXT("Placement"), FString::Printf(TEXT("Placement_%d"), Count));
+    }
+
+    FBenchmarkCommand PlacementBenchmarkCommand(
+        TEXT("Survival.Benchmark.Placement"),
+        TEXT("Times buildable placements with and without the buildable pool. Usage: Survival.Benchmark.Placement [Count]"),
+        true,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunPlacementBenchmark(World, GetCountArg(Args, 0, 1000));
+        }
+    );
+
+    /**
+     * @brief Times interaction target queries through the interactable index and the line trace
+     * @param World - World to spawn the interactables and the player in
+     * @param Samples - Queries per population size and path
+     * @return True if every p95 stayed within its threshold
+     */
+    bool RunInteractionBenchmark(UWorld* World, int32 Samples)
+    {
+        const int32 InteractableCounts[] = { 1000, 10000, 100000 };
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+        UClass* PlayerClass = GetPopulationClass<APlayerCharacter>(TEXT("PlayerCharacterClass"));
+        APlayerCharacter* Player = World->SpawnActor<APlayerCharacter>(PlayerClass, FTransform::Identity, SpawnParams);
+        if (!Player)
+        {
+            UE_LOG(LogGAM312SurvivalTests, Warning, TEXT("Interaction benchmark could not spawn a player character"));
+            return false;
+        }
+
+        // Alternate bushes and mineable resources, the two kinds of interactable actors
+        UClass* const InteractableClasses[] =
+        {
+            GetPopulationClass<ABerryBush>(TEXT("BerryBushClass")),
+            GetPopulationClass<AMineableResource>(TEXT("MineableResourceClass")),
+        };
+
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Samples,%d\n\n"), Samples);
+        FString Hits = TEXT("Interactables,IndexHits,TraceHits\n");
+
+        for (const int32 Count : InteractableCounts)
+        {
+            const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+            TArray<AActor*> Interactables;
+            Interactables.Reserve(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                const FVector Location((i % Side) * GridSpacing, (i / Side) * GridSpacing, 0.0f);
+                if (AActor* Actor = World->SpawnActor<AActor>(InteractableClasses[i % UE_ARRAY_COUNT(InteractableClasses)], Location, FRotator::ZeroRotator, SpawnParams))
+                {
+                    Interactables.Add(Actor);
+                }
+            }
+
+            // Random poses over the population, each queried through both paths
+            FRandomStream Random(0x1A7E);
+            const float Extent = Side * GridSpacing;
+            TArray<float> IndexSamples;
+            TArray<float> TraceSamples;
+            IndexSamples.Reserve(Samples);
+            TraceSamples.Reserve(Samples);
+            int32 NumIndexHits = 0;
+            int32 NumTraceHits = 0;
+            for (int32 Sample = 0; Sample < Samples; ++Sample)
+            {
+                const FVector Location(Random.FRandRange(0.0f, Extent), Random.FRandRange(0.0f, Extent), 0.0f);
+                Player->SetActorLocationAndRotation(Location, FRotator(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f));
+
+                Player->SetUseInteractionIndex(true);
+                uint64 StartCycles = FPlatformTime::Cycles64();
+                NumIndexHits += Player->FindInteractionTarget().IsValid() ? 1 : 0;
+                IndexSamples.Add(GetMillisecondsSince(StartCycles));
+
+                Player->SetUseInteractionIndex(false);
+                StartCycles = FPlatformTime::Cycles64();
+                NumTraceHits += Player->FindInteractionTarget().IsValid() ? 1 : 0;
+                TraceSamples.Add(GetMillisecondsSince(StartCycles));
+            }
+
+            Report.AddRow(FString::Printf(TEXT("Interaction Index %d"), Count), MoveTemp(IndexSamples));
+            Report.AddRow(FString::Printf(TEXT("Interaction Trace %d"), Count), MoveTemp(TraceSamples));
+            Hits.Appendf(TEXT("%d,%d,%d\n"), Count, NumIndexHits, NumTraceHits);
+
+            for (AActor* Actor : Interactables)
+            {
+                Actor->Destroy();
+            }
+        }
+        Player->Destroy();
+
+        Report.Csv.Append(TEXT("\n"));
+        Report.Csv.Append(Hits);
+        return Report.Save(TEXT("Interaction"), TEXT("Interaction"));
+    }
+
+    FBenchmarkCommand InteractionBenchmarkCommand(
+        TEXT("Survival.Benchmark.Interaction"),
+        TEXT("Times interaction target queries through the interactable index and the line trace at 1k, 10k and 100k interactables. Usage: Survival.Benchmark.Interaction [Samples]"),
+        true,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunInteractionBenchmark(World, GetCountArg(Args, 0, 1000));
+        }
+    );
+
+    /* Survivor counts the stats pass is timed at */
+    constexpr int32 SurvivorCounts[] = { 1000, 10000 };
+
+    /* Times the structure-of-arrays stats pass at increasing survivor counts */
+    bool RunStatsBenchmark(UWorld* World, int32 Samples)
+    {
+        USurvivalStatsSubsystem* StatsSubsystem = World->GetSubsystem<USurvivalStatsSubsystem>();
+        if (!StatsSubsystem) return false;
+
+        // The components are only registered with the pass, they never tick on their own
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        AActor* Owner = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!Owner) return false;
+
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Samples,%d\n\n"), Samples);
+
+        for (const int32 Count : SurvivorCounts)
+        {
+            TArray<USurvivalStatsComponent*> Survivors;
+            Survivors.Reserve(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                USurvivalStatsComponent* Survivor = NewObject<USurvivalStatsComponent>(Owner);
+                StatsSubsystem->AddSurvivor(Survivor);
+                Survivors.Add(Survivor);
+            }
+
+            TArray<float> StatsSamples;
+            StatsSamples.Reserve(Samples);
+            for (int32 Sample = 0; Sample < Samples; ++Sample)
+            {
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                StatsSubsystem->AdvanceAll(0.1f);
+                StatsSamples.Add(GetMillisecondsSince(StartCycles));
+            }
+
+            Report.AddRow(FString::Printf(TEXT("Survival Stats %d"), Count), MoveTemp(StatsSamples));
+
+            for (USurvivalStatsComponent* Survivor : Survivors)
+            {
+                StatsSubsystem->RemoveSurvivor(Survivor);
+                Survivor->MarkAsGarbage();
+            }
+        }
+        Owner->Destroy();
+
+        return Report.Save(TEXT("Stats"), TEXT("Stats"));
+    }
+
+    FBenchmarkCommand StatsBenchmarkCommand(
+        TEXT("Survival.Benchmark.Stats"),
+        TEXT("Times the survival stats pass over 1k and 10k survivors. Usage: Survival.Benchmark.Stats [Samples]"),
+        true,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunStatsBenchmark(World, GetCountArg(Args, 0, 1000));
+        }
+    );
+
+    /* Base of the synthetic interactables, owning them and carrying the class index for the chain */
+    class FSyntheticInteractable : public IInteractable
+    {
+    public:
+        explicit FSyntheticInteractable(int32 InClassIndex) : ClassIndex(InClassIndex) {}
+        virtual ~FSyntheticInteractable() {}
+
+        /* Index of the synthetic class */
+        const int32 ClassIndex;
+    };
+
+    /* One synthetic interactable class per Kind, each with its own implementation */
+    template <int32 Kind>
+    class TSyntheticInteractable final : public FSyntheticInteractable
+    {
+    public:
+        TSyntheticInteractable() : FSyntheticInteractable(Kind) {}
+
+        virtual FInteractionResult GetInteraction(int32 Item) const override
+        {
+            FInteractionResult Result;
+            Result.ResourceType = static_cast<EResourceType>(Kind % 3);
+            Result.Amount = Kind + 1;
+            Result.StaminaCost = Kind * 0.5f;
+            return Result;
+        }
+
+        virtual FInteractionResult Interact(AActor* Instigator, int32 Item) override
+        {
+            return GetInteraction(Item);
+        }
+    };
+
+    /* Number of synthetic interactable classes */
+    constexpr int32 NumSyntheticKinds = 20;
+
+    /* Creates an instance of a synthetic class */
+    template <int32... Kinds>
+    TUniquePtr<FSyntheticInteractable> MakeSyntheticInteractable(int32 Kind, TIntegerSequence<int32, Kinds...>)
+    {
+        using FFactory = FSyntheticInteractable* (*)();
+        static const FFactory Factories[] = { []() -> FSyntheticInteractable* { return new TSyntheticInteractable<Kinds>(); }... };
+        return TUniquePtr<FSyntheticInteractable>(Factories[Kind]());
+    }
+
+    /* Previews an interaction through an if/else chain over the first NumKinds classes, as the cast chain did */
+    template <int32... Kinds>
+    FInteractionResult GetInteractionByChain(const FSyntheticInteractable& Object, int32 NumKinds, TIntegerSequence<int32, Kinds...>)
+    {
+        FInteractionResult Result;
+        ((Kinds < NumKinds && Object.ClassIndex == Kinds
+            && (Result = static_cast<const TSyntheticInteractable<Kinds>&>(Object).TSyntheticInteractable<Kinds>::GetInteraction(INDEX_NONE), true)) || ...);
+        return Result;
+    }
+
+    /* Interactions previewed together as one sample, a single call is too short to time */
+    constexpr int32 DispatchCallsPerSample = 10000;
+
+    /**
+     * @brief Times interaction dispatch over 2 to 20 synthetic interactable classes
+     * @param Samples - Samples per class count and dispatch path
+     * @return True if the interface dispatch cost stayed flat within its threshold
+     */
+    bool RunDispatchBenchmark(int32 Samples)
+    {
+        const int32 KindCounts[] = { 2, 5, 10, NumSyntheticKinds };
+        const auto KindSequence = TMakeIntegerSequence<int32, NumSyntheticKinds>();
+
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Samples,%d\nCallsPerSample,%d\n\n"), Samples, DispatchCallsPerSample);
+
+        int64 Checksum = 0;
+        float SmallestP50 = 0.0f;
+        float LargestP50 = 0.0f;
+        for (const int32 NumKinds : KindCounts)
+        {
+            // Classes mixed at random, as the player would walk up to them
+            FRandomStream Random(0xD15C);
+            TArray<TUniquePtr<FSyntheticInteractable>> Objects;
+            Objects.Reserve(DispatchCallsPerSample);
+            for (int32 i = 0; i < DispatchCallsPerSample; ++i)
+            {
+                Objects.Add(MakeSyntheticInteractable(Random.RandRange(0, NumKinds - 1), KindSequence));
+            }
+
+            TArray<float> InterfaceSamples;
+            TArray<float> ChainSamples;
+            InterfaceSamples.Reserve(Samples);
+            ChainSamples.Reserve(Samples);
+            for (int32 Sample = 0; Sample < Samples; ++Sample)
+            {
+                uint64 StartCycles = FPlatformTime::Cycles64();
+                for (const TUniquePtr<FSyntheticInteractable>& Object : Objects)
+                {
+                    const IInteractable* Interactable = Object.Get();
+                    Checksum += Interactable->GetInteraction(INDEX_NONE).Amount;
+                }
+                InterfaceSamples.Add(GetMillisecondsSince(StartCycles));
+
+                StartCycles = FPlatformTime::Cycles64();
+                for (const TUniquePtr<FSyntheticInteractable>& Object : Objects)
+                {
+                    Checksum += GetInteractionByChain(*Object, NumKinds, KindSequence).Amount;
+                }
+                ChainSamples.Add(GetMillisecondsSince(StartCycles));
+            }
+
+            LargestP50 = GetMedian(InterfaceSamples);
+            SmallestP50 = SmallestP50 > 0.0f ? SmallestP50 : LargestP50;
+            Report.AddRow(FString::Printf(TEXT("Dispatch Interface %d"), NumKinds), MoveTemp(InterfaceSamples));
+            Report.AddRow(FString::Printf(TEXT("Dispatch Chain %d"), NumKinds), MoveTemp(ChainSamples));
+        }
+
+        // A single virtual call should cost the same however many classes there are
+        Report.CheckCostGrowth(TEXT("Dispatch"), SmallestP50, LargestP50,
+            FString::Printf(TEXT("from %d to %d classes"), KindCounts[0], NumSyntheticKinds));
+        Report.Csv.Appendf(TEXT("Checksum,%lld\n"), Checksum);
+        return Report.Save(TEXT("Dispatch"), TEXT("Dispatch"));
+    }
+
+    FBenchmarkCommand DispatchBenchmarkCommand(
+        TEXT("Survival.Benchmark.Dispatch"),
+        TEXT("Times interaction dispatch through IInteractable and through an if/else chain over 2 to 20 synthetic classes. Usage: Survival.Benchmark.Dispatch [Samples]"),
+        false,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunDispatchBenchmark(GetCountArg(Args, 0, 1000));
+        }
+    );
+
+    /* Snap queries timed together as one sample, a single query is too short to time */
+    constexpr int32 SnapQueriesPerSample = 100;
+
+    /* Times snapping and validating previews against structure grids of growing size */
+    bool RunSnapBenchmark(int32 Samples)
+    {
+        const int32 PartCounts[] = { 100, 1000, 10000, 100000 };
+        constexpr float CellSize = 400.0f;
+
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Samples,%d\nQueriesPerSample,%d\n\n"), Samples, SnapQueriesPerSample);
+
+        int32 NumValid = 0;
+        float SmallestP50 = 0.0f;
+        float LargestP50 = 0.0f;
+        for (const int32 NumParts : PartCounts)
+        {
+            // A square base of floors with a wall on each, like a sprawling single-storey build
+            FStructureGrid Grid(CellSize);
+            const int32 Side = FMath::CeilToInt(FMath::Sqrt(NumParts * 0.5f));
+            for (int32 i = 0; Grid.Num() < NumParts; ++i)
+            {
+                const FIntVector Cell(i % Side, i / Side, 0);
+                Grid.Occupy(FStructureSlot(Cell, EStructureSlotFace::Floor));
+                if (Grid.Num() < NumParts)
+                {
+                    Grid.Occupy(FStructureSlot(Cell, EStructureSlotFace::WallX));
+                }
+            }
+
+            // Same seed for every size, so only the grid differs between rows
+            FRandomStream Random(0x5A4B);
+            const float Extent = Side * CellSize;
+            TArray<float> SampleTimes;
+            SampleTimes.Reserve(Samples);
+            for (int32 Sample = 0; Sample < Samples; ++Sample)
+            {
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                for (int32 Query = 0; Query < SnapQueriesPerSample; ++Query)
+                {
+                    const EBuildableType Type = static_cast<EBuildableType>(Random.RandRange(0, 2));
+                    const FVector Location(Random.FRandRange(0.0f, Extent), Random.FRandRange(0.0f, Extent), Random.FRandRange(0.0f, CellSize * 2.0f));
+                    const FStructureSlot Slot = Grid.FindSnapSlot(Type, Location);
+                    NumValid += Grid.CanPlace(Slot, false) ? 1 : 0;
+                }
+                SampleTimes.Add(GetMillisecondsSince(StartCycles));
+            }
+
+            LargestP50 = GetMedian(SampleTimes);
+            SmallestP50 = SmallestP50 > 0.0f ? SmallestP50 : LargestP50;
+            Report.AddRow(FString::Printf(TEXT("Snap %d"), NumParts), MoveTemp(SampleTimes));
+        }
+
+        // Cost should stay flat with the number of placed parts, hash misses aside
+        Report.CheckCostGrowth(TEXT("Snap"), SmallestP50, LargestP50,
+            FString::Printf(TEXT("from %d to %d parts"), PartCounts[0], PartCounts[UE_ARRAY_COUNT(PartCounts) - 1]));
+        Report.Csv.Appendf(TEXT("ValidPlacements,%d\n"), NumValid);
+        return Report.Save(TEXT("Snap"), TEXT("Snap"));
+    }
+
+    FBenchmarkCommand SnapBenchmarkCommand(
+        TEXT("Survival.Benchmark.Snap"),
+        TEXT("Times structure grid snap queries from 100 to 100k placed parts. Usage: Survival.Benchmark.Snap [Samples]"),
+        false,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunSnapBenchmark(GetCountArg(Args, 0, 1000));
+        }
+    );
+
+    /* Adds and removes parts in a large base and times the structural integrity updates */
+    bool RunIntegrityBenchmark(int32 NumParts, int32 NumUpdates)
+    {
+        // Grounded floors with a wall on two sides of each and a second storey of floors on top
+        const int32 Side = FMath::Max(FMath::CeilToInt(FMath::Sqrt(NumParts * 0.25f)), 1);
+        TArray<TPair<FStructureSlot, bool>> Parts;
+        Parts.Reserve(Side * Side * 4);
+        for (const EStructureSlotFace Face : { EStructureSlotFace::Floor, EStructureSlotFace::WallX, EStructureSlotFace::WallY })
+        {
+            for (int32 i = 0; i < Side * Side; ++i)
+            {
+                Parts.Emplace(FStructureSlot(FIntVector(i % Side, i / Side, 0), Face), Face == EStructureSlotFace::Floor);
+            }
+        }
+        for (int32 i = 0; i < Side * Side; ++i)
+        {
+            Parts.Emplace(FStructureSlot(FIntVector(i % Side, i / Side, 1), EStructureSlotFace::Floor), false);
+        }
+
+        FStructuralIntegrityGraph Graph;
+        TArray<float> AddSamples;
+        TArray<float> RemoveSamples;
+        AddSamples.Reserve(Parts.Num() + NumUpdates);
+        RemoveSamples.Reserve(NumUpdates);
+        TMap<FStructureSlot, bool> Grounded;
+        Grounded.Reserve(Parts.Num());
+
+        for (const TPair<FStructureSlot, bool>& Part : Parts)
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Graph.Add(Part.Key, Part.Value);
+            AddSamples.Add(GetMillisecondsSince(StartCycles));
+            Grounded.Add(Part.Key, Part.Value);
+        }
+
+        // Remove random parts and put them back, collapsed ones included, so the base keeps its size
+        FRandomStream Random(0x1D7E);
+        TArray<FStructureSlot> Collapsed;
+        int32 NumCollapsed = 0;
+        int32 MaxVisited = 0;
+        for (int32 Update = 0; Update < NumUpdates; ++Update)
+        {
+            const FStructureSlot Slot = Parts[Random.RandRange(0, Parts.Num() - 1)].Key;
+
+            Collapsed.Reset();
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Graph.Remove(Slot, Collapsed);
+            RemoveSamples.Add(GetMillisecondsSince(StartCycles));
+            MaxVisited = FMath::Max(MaxVisited, Graph.GetNumVisited());
+            NumCollapsed += Collapsed.Num();
+
+            // Bottom up, floors before the walls standing on them
+            Collapsed.Add(Slot);
+            Collapsed.Sort([](const FStructureSlot& A, const FStructureSlot& B)
+            {
+                return A.Cell.Z != B.Cell.Z ? A.Cell.Z < B.Cell.Z : A.Face < B.Face;
+            });
+            for (const FStructureSlot& Restored : Collapsed)
+            {
+                const uint64 AddStartCycles = FPlatformTime::Cycles64();
+                Graph.Add(Restored, Grounded.FindChecked(Restored));
+                AddSamples.Add(GetMillisecondsSince(AddStartCycles));
+                MaxVisited = FMath::Max(MaxVisited, Graph.GetNumVisited());
+            }
+        }
+
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Parts,%d\nUpdates,%d\nCollapsed,%d\nMaxVisited,%d\n\n"), Graph.Num(), NumUpdates, NumCollapsed, MaxVisited);
+        Report.AddRow(TEXT("Integrity Add"), MoveTemp(AddSamples));
+        Report.AddRow(TEXT("Integrity Remove"), MoveTemp(RemoveSamples));
+        return Report.Save(TEXT("Integrity"), FString::Printf(TEXT("Integrity_%d"), Graph.Num()));
+    }
+
+    FBenchmarkCommand IntegrityBenchmarkCommand(
+        TEXT("Survival.Benchmark.Integrity"),
+        TEXT("Times structural integrity updates in a large base. Usage: Survival.Benchmark.Integrity [Parts] [Updates]"),
+        false,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunIntegrityBenchmark(GetCountArg(Args, 0, 50000), GetCountArg(Args, 1, 1000));
+        }
+    );
+
+    /* Times one wheel advancing frame by frame with a steady population of pending respawns */
+    TArray<float> TimeRespawnWheel(TTimingWheel<int32>& Wheel, int32 NumPending, int32 NumFrames, int32& OutNumRespawned)
+    {
+        constexpr float FrameSeconds = 1.0f / 60.0f;
+        constexpr float MinRespawnSeconds = 60.0f;
+        constexpr float MaxRespawnSeconds = 3600.0f;
+
+        FRandomStream Random(0x5EED);
+        for (int32 i = 0; i < NumPending; ++i)
+        {
+            Wheel.Schedule(i, Random.FRandRange(0.0f, MaxRespawnSeconds));
+        }
+
+        // Every respawned node is depleted again right away, so the wheel keeps its size
+        TArray<float> Samples;
+        Samples.Reserve(NumFrames);
+        OutNumRespawned = 0;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            OutNumRespawned += Wheel.Advance(FrameSeconds, [&Wheel, &Random](int32 Node)
+            {
+                Wheel.Schedule(Node, Random.FRandRange(MinRespawnSeconds, MaxRespawnSeconds));
+            });
+            Samples.Add(GetMillisecondsSince(StartCycles));
+        }
+        return Samples;
+    }
+
+    /**
+     * @brief Times the respawn wheel with a large number of pending respawns, against a single level wheel
+     * @param NumPending - Pending respawns kept in the wheel
+     * @param NumFrames - Frames of 1/60 s to simulate
+     * @return True if the p95 per frame stayed within its threshold
+     */
+    bool RunRespawnBenchmark(int32 NumPending, int32 NumFrames)
+    {
+        // Same layout as UResourceRespawnSubsystem, and the same slots as one level
+        TTimingWheel<int32> Hierarchical(1.0f, 64, 3);
+        TTimingWheel<int32> SingleLevel(1.0f, 64, 1);
+
+        int32 NumRespawned = 0;
+        int32 NumRespawnedSingleLevel = 0;
+        TArray<float> Samples = TimeRespawnWheel(Hierarchical, NumPending, NumFrames, NumRespawned);
+        TArray<float> SingleLevelSamples = TimeRespawnWheel(SingleLevel, NumPending, NumFrames, NumRespawnedSingleLevel);
+
+        // Only the hierarchical wheel has a threshold, the single level one is for comparison
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Pending,%d\nFrames,%d\nRespawned,%d\n\n"), Hierarchical.Num(), NumFrames, NumRespawned);
+        Report.AddRow(TEXT("Respawn Wheel"), MoveTemp(Samples));
+        Report.AddRow(TEXT("Respawn Single Level"), MoveTemp(SingleLevelSamples));
+        return Report.Save(TEXT("Respawn"), FString::Printf(TEXT("Respawn_%d"), NumPending));
+    }
+
+    FBenchmarkCommand RespawnBenchmarkCommand(
+        TEXT("Survival.Benchmark.Respawn"),
+        TEXT("Times the resource respawn wheel per frame with many pending respawns. Usage: Survival.Benchmark.Respawn [Pending] [Frames]"),
+        false,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunRespawnBenchmark(GetCountArg(Args, 0, 100000), GetCountArg(Args, 1, 36000));
+        }
+    );
+
+    /* Spawns butterflies and times the per-frame retarget cost with the wander scheduler on or off */
+    TArray<float> TimeWanderRetargets(UWorld* World, int32 NumButterflies, int32 NumFrames, bool bUseScheduler)
+    {
+        constexpr float FrameSeconds = 1.0f / 60.0f;
+
+        // Butterflies pick the scheduler or a timer each when they retarget, so set the switch before spawning
+        IConsoleVariable* SchedulerVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("survival.Butterfly.WanderScheduler"));
+        const bool bPreviousUseScheduler = SchedulerVariable->GetBool();
+        SchedulerVariable->Set(bUseScheduler, ECVF_SetByCode);
+
+        UClass* ButterflyClass = GetPopulationClass<AButterflyWander>(TEXT("ButterflyClass"));
+        const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumButterflies)));
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        TArray<AActor*> Butterflies;
+        Butterflies.Reserve(NumButterflies);
+        for (int32 i = 0; i < NumButterflies; ++i)
+        {
+            const FVector Location((i % Side) * GridSpacing, (i / Side) * GridSpacing, 200.0f);
+            Butterflies.Add(World->SpawnActor<AActor>(ButterflyClass, FTransform(Location), SpawnParams));
+        }
+
+        // Only the retarget path is ticked, the timer manager refuses a second tick in the same engine frame
+        UWanderSchedulerSubsystem* Scheduler = World->GetSubsystem<UWanderSchedulerSubsystem>();
+        FTimerManager& TimerManager = World->GetTimerManager();
+        TArray<float> Samples;
+        Samples.Reserve(NumFrames);
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            ++GFrameCounter;
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            if (bUseScheduler)
+            {
+                Scheduler->Tick(FrameSeconds);
+            }
+            else
+            {
+                TimerManager.Tick(FrameSeconds);
+            }
+            Samples.Add(GetMillisecondsSince(StartCycles));
+        }
+
+        // Destroying clears the timers, and the scheduler skips butterflies that are gone
+        for (AActor* Butterfly : Butterflies)
+        {
+            if (Butterfly) Butterfly->Destroy();
+        }
+        SchedulerVariable->Set(bPreviousUseScheduler, ECVF_SetByCode);
+        return Samples;
+    }
+
+    /**
+     * @brief Times butterfly retargeting through the wander scheduler's wheel against a timer manager timer each
+     * @param World - World to spawn the butterflies in
+     * @param NumButterflies - Butterflies retargeting at once
+     * @param NumFrames - Frames of 1/60 s to simulate per path
+     * @return True if every p95 stayed within its threshold
+     */
+    bool RunWanderBenchmark(UWorld* World, int32 NumButterflies, int32 NumFrames)
+    {
+        if (!World->GetSubsystem<UWanderSchedulerSubsystem>()) return false;
+
+        TArray<float> SchedulerSamples = TimeWanderRetargets(World, NumButterflies, NumFrames, true);
+        TArray<float> TimerSamples = TimeWanderRetargets(World, NumButterflies, NumFrames, false);
+
+        UE_LOG(LogGAM312SurvivalTests, Display, TEXT("Wander retargets of %d butterflies: p50 %.4f ms through the scheduler, %.4f ms through timers"),
+            NumButterflies, GetMedian(SchedulerSamples), GetMedian(TimerSamples));
+
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Butterflies,%d
+Frames,%d
+
+"), NumButterflies, NumFrames);
+        Report.AddRow(TEXT("Wander Scheduler"), MoveTemp(SchedulerSamples));
+        Report.AddRow(TEXT("Wander Timers"), MoveTemp(TimerSamples));
+        return Report.Save(TEXT("Wander"), FString::Printf(TEXT("Wander_%d"), NumButterflies));
+    }
+
+    FBenchmarkCommand WanderBenchmarkCommand(
+        TEXT("Survival.Benchmark.Wander"),
+        TEXT("Times butterfly retargets per frame with survival.Butterfly.WanderScheduler on and off. Usage: Survival.Benchmark.Wander [Butterflies] [Frames]"),
+        true,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunWanderBenchmark(World, GetCountArg(Args, 0, 10000), GetCountArg(Args, 1, 3600));
+        }
+    );
+
+    /* Sums the size of the package files under a directory */
+    int64 GetPackageFilesSize(const FString& Directory, int32& OutNumFiles)
+    {
+        TArray<FString> Files;
+        IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*.uasset"), true, false);
+        OutNumFiles = Files.Num();
+
+        int64 Size = 0;
+        for (const FString& File : Files)
+        {
+            Size += FMath::Max<int64>(IFileManager::Get().FileSize(*File), 0);
+        }
+        return Size;
+    }
+
+    /* Reports the memory resource states take per placed resource and the size of the map on disk */
+    bool RunResourceMemoryReport(UWorld* World)
+    {
+        if (!World) return false;
+
+        int32 NumResources = 0;
+        int32 NumWithDefinition = 0;
+        int64 InstanceBytes = 0;
+        int64 LegacyStateBytes = 0;
+        TSet<const UResourceDefinition*> Definitions;
+
+        for (TActorIterator<AMineableResource> It(World); It; ++It)
+        {
+            ++NumResources;
+            InstanceBytes += It->GetClass()->GetStructureSize();
+
+            // Legacy states live in every instance, definitions are counted once below
+            if (const UResourceDefinition* Definition = It->GetDefinition())
+            {
+                ++NumWithDefinition;
+                Definitions.Add(Definition);
+            }
+            else
+            {
+                LegacyStateBytes += It->GetResourceStates().GetAllocatedSize();
+            }
+        }
+
+        int64 DefinitionBytes = 0;
+        for (const UResourceDefinition* Definition : Definitions)
+        {
+            DefinitionBytes += Definition->GetClass()->GetStructureSize() + Definition->States.GetAllocatedSize();
+        }
+
+        // The level package plus one package per actor under __ExternalActors__
+        const FString LevelPackageName = UWorld::RemovePIEPrefix(World->GetOutermost()->GetName());
+        FString LevelFilename;
+        int64 LevelPackageBytes = 0;
+        if (FPackageName::DoesPackageExist(LevelPackageName, &LevelFilename))
+        {
+            LevelPackageBytes = IFileManager::Get().FileSize(*LevelFilename);
+        }
+        int32 NumExternalActors = 0;
+        const FString ExternalActorsDirectory = FPackageName::LongPackageNameToFilename(ULevel::GetExternalActorsPath(LevelPackageName));
+        const int64 ExternalActorBytes = GetPackageFilesSize(ExternalActorsDirectory, NumExternalActors);
+
+        const int64 StateBytes = LegacyStateBytes + DefinitionBytes;
+        FReport Report;
+        Report.Csv.Appendf(TEXT("Map,%s\n\n"), *LevelPackageName);
+        Report.Csv.Appendf(TEXT("Resources,%d\nWithDefinition,%d\nLegacy,%d\nDefinitions,%d\n\n"),
+            NumResources, NumWithDefinition, NumResources - NumWithDefinition, Definitions.Num());
+        Report.Csv.Appendf(TEXT("InstanceBytes,%lld\nLegacyStateBytes,%lld\nDefinitionBytes,%lld\nStateBytesPerResource,%.1f\n\n"),
+            InstanceBytes, LegacyStateBytes, DefinitionBytes, NumResources > 0 ? static_cast<double>(StateBytes) / NumResources : 0.0);
+        Report.Csv.Appendf(TEXT("LevelPackageBytes,%lld\nExternalActorPackages,%d\nExternalActorBytes,%lld\nMapBytes,%lld\n"),
+            LevelPackageBytes, NumExternalActors, ExternalActorBytes, LevelPackageBytes + ExternalActorBytes);
+
+        UE_LOG(LogGAM312SurvivalTests, Display, TEXT("Resource memory: %d resources (%d with a definition), %.1f state bytes each, map %lld bytes"),
+            NumResources, NumWithDefinition, NumResources > 0 ? static_cast<double>(StateBytes) / NumResources : 0.0,
+            LevelPackageBytes + ExternalActorBytes);
+        return Report.Save(TEXT("Resource memory"), FString::Printf(TEXT("ResourceMemory_%s"), *FPackageName::GetShortName(LevelPackageName)));
+    }
+
+    FBenchmarkCommand ResourceMemoryCommand(
+        TEXT("Survival.Benchmark.ResourceMemory"),
+        TEXT("Reports per-resource state memory and the map's package size, to compare legacy states with resource definitions."),
+        false,
+        [](const TArray<FString>& Args, UWorld* World)
+        {
+            return RunResourceMemoryReport(World);
+        }
+    );
+
+    /* Starts a frame-sampled run, which reports and exits by itself once done */
+    void StartRun(UWorld* World, const FSurvivalBenchmark::FSettings& Settings)
+    {
+        if (!FSurvivalBenchmark::Start(World, Settings))
+        {
+            UE_LOG(LogGAM312SurvivalTests, Warning, TEXT("Benchmark could not start, one may already be running"));
+        }
+    }
+
+    FAutoConsoleCommandWithWorldAndArgs BenchmarkCommand(
+        TEXT("Survival.Benchmark"),
+        TEXT("Spawns scaled populations and reports per-system frame costs. Usage: Survival.Benchmark [Scale] [Frames] [Swarm] [Lazy]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            FSurvivalBenchmark::FSettings Settings;
+            Settings.Scale = GetCountArg(Args, 0, Settings.Scale);
+            Settings.Frames = GetCountArg(Args, 1, Settings.Frames);
+            Settings.bButterflySwarm = HasFlagArg(Args, TEXT("Swarm"));
+            Settings.bLazyRegrowth = HasFlagArg(Args, TEXT("Lazy"));
+            StartRun(World, Settings);
+        })
+    );
+
+    FAutoConsoleCommandWithWorldAndArgs RegrowthBenchmarkCommand(
+        TEXT("Survival.Benchmark.Regrowth"),
+        TEXT("Reports the per-frame cost of regrowing berry bushes, batched or with a timer each. Usage: Survival.Benchmark.Regrowth [Count] [Frames] [Lazy]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+        {
+            FSurvivalBenchmark::FSettings Settings;
+            Settings.RegrowthBushes = GetCountArg(Args, 0, 10000);
+            Settings.Frames = GetCountArg(Args, 1, Settings.Frames);
+            Settings.bLazyRegrowth = HasFlagArg(Args, TEXT("Lazy"));
+
+            // Thresholds are per unit of scale, which is 200 bushes in a full run
+            Settings.Scale = FMath::DivideAndRoundUp(Settings.RegrowthBushes, 200);
+            StartRun(World, Settings);
+        })
+    );
+}
+
+bool FSurvivalBenchmark::Start(UWorld* World, const FSettings& Settings)
+{
+    // Drop runs whose world went away before they finished
+    if (Active && !Active->World.IsValid())
+    {
+        Active.Reset();
+    }
+
+    if (!World || !World->IsGameWorld() || Active) return false;
+
+    Active = TUniquePtr<FSurvivalBenchmark>(new FSurvivalBenchmark(World, Settings));
+    return true;
+}
+
+FSurvivalBenchmark::FSurvivalBenchmark(UWorld* InWorld, const FSettings& InSettings)
+    : World(InWorld)
+    , Settings(InSettings)
+{
+    UE_LOG(LogGAM312SurvivalTests, Display, TEXT("Benchmark started: scale %d, %d frames, butterflies as %s, %s regrowth%s"),
+        Settings.Scale, Settings.Frames, Settings.bButterflySwarm ? TEXT("a swarm") : TEXT("actors"),
+        Settings.bLazyRegrowth ? TEXT("lazy") : TEXT("batched"),
+        Settings.RegrowthBushes > 0 ? *FString::Printf(TEXT(", %d regrowing bushes only"), Settings.RegrowthBushes) : TEXT(""));
+
+    StartUsedMemory = FPlatformMemory::GetStats().UsedPhysical;
+    SpawnPopulations();
+
+    // Simulate the same game time on every run regardless of machine speed
+    bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+    PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+    FApp::SetUseFixedTimeStep(true);
+    FApp::SetFixedDeltaTime(Settings.FixedDeltaTime);
+
+    FrameSamples.Reserve(Settings.Frames);
+    for (TArray<float>& Samples : SystemSamples)
+    {
+        Samples.Reserve(Settings.Frames);
+    }
+
+    FMemory::Memcpy(StartTickCounts, UAmbientSignificanceSubsystem::TickCounts, sizeof(StartTickCounts));
+
+    // Gather the per-system timers for the whole run
+    ++FSurvivalDebugTimers::NumListeners;
+    FMemory::Memcpy(LastCycles, FSurvivalDebugTimers::Cycles, sizeof(LastCycles));
+    LastSampleTime = FPlatformTime::Seconds();
+
+    PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FSurvivalBenchmark::OnPostActorTick);
+}
+
+FSurvivalBenchmark::~FSurvivalBenchmark()
+{
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostTickHandle);
+    --FSurvivalDebugTimers::NumListeners;
+
+    FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+    FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+
+    for (const TWeakObjectPtr<AActor>& Actor : SpawnedActors)
+    {
+        if (Actor.IsValid())
+        {
+            Actor->Destroy();
+        }
+    }
+}
+
+void FSurvivalBenchmark::SpawnPopulations()
+{
+    UWorld* SpawnWorld = World.Get();
+
+    struct FPopulation
+    {
+        UClass* Class;
+        int32 Count;
+    };
+
+    // Regrowth runs only spawn the bushes
+    const bool bFullRun = Settings.RegrowthBushes <= 0;
+    const FPopulation Populations[] =
+    {
+        { SurvivalBenchmark::GetPopulationClass<ABerryBush>(TEXT("BerryBushClass")), bFullRun ? 200 * Settings.Scale : Settings.RegrowthBushes },
+        { SurvivalBenchmark::GetPopulationClass<AMineableResource>(TEXT("MineableResourceClass")), bFullRun ? 100 * Settings.Scale : 0 },
+        { SurvivalBenchmark::GetPopulationClass<AButterflyWander>(TEXT("ButterflyClass")), bFullRun && !Settings.bButterflySwarm ? 100 * Settings.Scale : 0 },
+        { SurvivalBenchmark::GetPopulationClass<ABuildableBase>(TEXT("BuildableClass")), bFullRun ? 50 * Settings.Scale : 0 },
+    };
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    // Each population gets its own square block, laid out side by side along X
+    float BlockOffset = 0.0f;
+    for (const FPopulation& Population : Populations)
+    {
+        const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Population.Count)));
+        for (int32 i = 0; i < Population.Count; ++i)
+        {
+            const FVector Location(
+                BlockOffset + (i % Side) * SurvivalBenchmark::GridSpacing,
+                (i / Side) * SurvivalBenchmark::GridSpacing,
+                0.0f
+            );
+
+            if (AActor* Actor = SpawnWorld->SpawnActor<AActor>(Population.Class, Location, FRotator::ZeroRotator, SpawnParams))
+            {
+                SpawnedActors.Add(Actor);
+
+                if (ABerryBush* Bush = Cast<ABerryBush>(Actor))
+                {
+                    Bush->SetRegrowthMode(Settings.bLazyRegrowth ? EBerryRegrowthMode::Lazy : EBerryRegrowthMode::Batched);
+
+                    // Regrowth only costs anything while berries are regrowing
+                    if (!bFullRun)
+                    {
+                        Bush->CollectBerry();
+                    }
+                }
+            }
+        }
+        BlockOffset += (Side + 1) * SurvivalBenchmark::GridSpacing;
+    }
+
+    // The swarm covers the same area the butterfly actors would
+    if (bFullRun && Settings.bButterflySwarm)
+    {
+        const int32 Count = 100 * Settings.Scale;
+        const float Radius = FMath::Sqrt(static_cast<float>(Count)) * SurvivalBenchmark::GridSpacing * 0.5f;
+        const FTransform Transform(FVector(BlockOffset + Radius, Radius, 0.0f));
+
+        UClass* SwarmClass = SurvivalBenchmark::GetPopulationClass<AButterflySwarm>(TEXT("ButterflySwarmClass"));
+        if (AButterflySwarm* Swarm = SpawnWorld->SpawnActorDeferred<AButterflySwarm>(SwarmClass, Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn))
+        {
+            Swarm->ButterflyCount = Count;
+            Swarm->SpawnRadius = Radius;
+            Swarm->FinishSpawning(Transform);
+            SpawnedActors.Add(Swarm);
+        }
+    }
+}
+
+void FSurvivalBenchmark::OnPostActorTick(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds)
+{
+    if (TickedWorld != World.Get() || FrameSamples.Num() >= Settings.Frames) return;
+
+    // Wall time between samples covers the whole frame, not just game code
+    const double Now = FPlatformTime::Seconds();
+    FrameSamples.Add(static_cast<float>((Now - LastSampleTime) * 1000.0));
+    LastSampleTime = Now;
+
+    for (int32 i = 0; i < FSurvivalDebugTimers::NumTimers; ++i)
+    {
+        SystemSamples[i].Add(static_cast<float>(FPlatformTime::ToMilliseconds64(FSurvivalDebugTimers::Cycles[i] - LastCycles[i])));
+        LastCycles[i] = FSurvivalDebugTimers::Cycles[i];
+    }
+
+    if (FrameSamples.Num() < Settings.Frames) return;
+
+    const bool bPassed = Report();
+
+    // Tear down outside of the world tick that is currently broadcasting
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([bPassed](float)
+    {
+        Active.Reset();
+        if (FApp::IsUnattended())
+        {
+            FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+        }
+        return false;
+    }));
+}
+
+bool FSurvivalBenchmark::Report() const
+{
+    const int64 MemoryDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(StartUsedMemory);
+
+    SurvivalBenchmark::FReport Results;
+    Results.Csv.Appendf(TEXT("Scale,%d\nFrames,%d\nFixedDeltaTime,%.6f\nButterflySwarm,%s\nLazyRegrowth,%s\nRegrowthBushes,%d\nMemoryDeltaMB,%.2f\n\n"),
+        Settings.Scale, Settings.Frames, Settings.FixedDeltaTime, Settings.bButterflySwarm ? TEXT("true") : TEXT("false"),
+        Settings.bLazyRegrowth ? TEXT("true") : TEXT("false"), Settings.RegrowthBushes, MemoryDelta / (1024.0 * 1024.0));
+
+    // Ambient actors and their ticks over the run, per significance bucket
+    const UAmbientSignificanceSubsystem* AmbientSignificance = World.IsValid() ? World->GetSubsystem<UAmbientSignificanceSubsystem>() : nullptr;
+    Results.Csv.Append(TEXT("Significance,Actors,Ticks\n"));
+    for (int32 i = 0; i < UAmbientSignificanceSubsystem::NumBuckets; ++i)
+    {
+        const EAmbientSignificance Bucket = static_cast<EAmbientSignificance>(i);
+        Results.Csv.Appendf(TEXT("%s,%d,%llu\n"),
+            *StaticEnum<EAmbientSignificance>()->GetNameStringByValue(i),
+            AmbientSignificance ? AmbientSignificance->GetNumInBucket(Bucket) : 0,
+            UAmbientSignificanceSubsystem::TickCounts[i] - StartTickCounts[i]);
+    }
+    Results.Csv.Append(TEXT("\n"));
+
+    SurvivalBenchmark::AddPrimitiveCounts(Results, World.Get(), Settings.Scale);
+
+    // The frame budget and the per-player systems do not grow with the populations
+    Results.AddRow(TEXT("Frame"), FrameSamples);
+    for (int32 i = 0; i < FSurvivalDebugTimers::NumTimers; ++i)
+    {
+        const ESurvivalDebugTimer Timer = static_cast<ESurvivalDebugTimer>(i);
+        const int32 Scale = SurvivalBenchmark::ScalesWithPopulation(Timer) ? Settings.Scale : 1;
+        Results.AddRow(FSurvivalDebugTimers::GetName(Timer), SystemSamples[i], Scale);
+    }
+
+    const FString ReportName = Settings.RegrowthBushes > 0
+        ? FString::Printf(TEXT("Regrowth_%d"), Settings.RegrowthBushes)
+        : FString::Printf(TEXT("x%d%s"), Settings.Scale, Settings.bButterflySwarm ? TEXT("_Swarm") : TEXT(""));
+    return Results.Save(TEXT("Population"), ReportName + (Settings.bLazyRegrowth ? TEXT("_Lazy") : TEXT("")));
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "SurvivalDebugOverlay.h"
+#include "AmbientSignificanceSubsystem.h"
+
+class UWorld;
+class AActor;
+
+/**
+ * @class FSurvivalBenchmark
+ * @brief Spawns scaled populations of the game's actors and reports what each system costs
+ *
+ * Started with "Survival.Benchmark [Scale] [Frames] [Swarm]", e.g. from a headless run:
+ * -game -nullrhi -unattended -ExecCmds="Survival.Benchmark 4 600"
+ *
+ * Butterflies are spawned as individual actors, or as one AButterflySwarm when "Swarm" is
+ * passed, so both can be compared at e.g. 1k, 10k and 50k butterflies with scales 10, 100
+ * and 500.
+ *
+ * While running, the engine uses a fixed timestep so every run simulates the same amount
+ * of game time. Frame times and the per-system debug timers are sampled every frame. When
+ * done, percentiles, ambient tick counts per significance bucket, primitive and render
+ * proxy counts and the memory delta are written as CSV to the profiling directory, and
+ * p95 values and the primitive count are compared against the [SurvivalBenchmark]
+ * thresholds in DefaultGame.ini.
+ * Unattended runs exit with a non-zero code if any threshold regressed.
+ *
+ * Nothing is rendered under -nullrhi, so every ambient actor past the near distance
+ * counts as out of view and is culled; the per-bucket tick counts are only meaningful
+ * in runs that render.
+ *
+ * "Survival.Benchmark.Regrowth [Count] [Frames] [Lazy]" runs the same sampling with only
+ * Count collected berry bushes regrowing, batched by UBerryRegrowthSubsystem or through
+ * a timer per bush when "Lazy" is passed; "Lazy" also applies to the full run.
+ *
+ * "Survival.Benchmark.Interaction [Samples]" times FindInteractionTarget through the
+ * interactable index and through the line trace at 1k, 10k and 100k interactables.
+ *
+ * "Survival.Benchmark.Stats [Samples]" times one USurvivalStatsSubsystem pass over 1k and
+ * 10k survivors.
+ *
+ * "Survival.Benchmark.Dispatch [Samples]" times IInteractable dispatch against an if/else
+ * chain over 2 to 20 synthetic interactable classes.
+ *
+ * "Survival.Benchmark.Placement [Count]" separately times placing Count buildables with a
+ * full spawn each and with the buildable pool, reported the same way.
+ *
+ * "Survival.Benchmark.Wander [Butterflies] [Frames]" spawns 10k butterflies by default
+ * and times their retargets per frame, once through UWanderSchedulerSubsystem's wheel
+ * and once through FTimerManager::Tick with survival.Butterfly.WanderScheduler off.
+ *
+ * These single-shot benchmarks are registered through SurvivalBenchmark::FBenchmarkCommand
+ * and report through SurvivalBenchmark::FReport, so a new one only adds its measurement.
+ */
+class FSurvivalBenchmark
+{
+public:
+    /* Benchmark parameters */
+    struct FSettings
+    {
+        /* Population multiplier */
+        int32 Scale = 1;
+
+        /* Number of frames to sample */
+        int32 Frames = 600;
+
+        /* Fixed timestep used while sampling */
+        float FixedDeltaTime = 1.0f / 60.0f;
+
+        /* Whether butterflies are simulated by a swarm instead of individual actors */
+        bool bButterflySwarm = false;
+
+        /* Whether berry bushes regrow through their own timers instead of the regrowth subsystem */
+        bool bLazyRegrowth = false;
+
+        /* Collected berry bushes to spawn instead of the full populations, 0 for a full run */
+        int32 RegrowthBushes = 0;
+    };
+
+    /**
+     * @brief Starts a benchmark run in a world
+     * @param World - World to spawn the populations in
+     * @param Settings - Benchmark parameters
+     * @return False if a run is already in progress or the world is invalid
+     */
+    static bool Start(UWorld* World, const FSettings& Settings);
+
+    ~FSurvivalBenchmark();
+
+private:
+    FSurvivalBenchmark(UWorld* InWorld, const FSettings& InSettings);
+
+    /* Run in progress, if any */
+    static TUniquePtr<FSurvivalBenchmark> Active;
+
+    /* World the populations live in */
+    TWeakObjectPtr<UWorld> World;
+
+    /* Benchmark parameters */
+    FSettings Settings;
+
+    /* Actors spawned for the run, destroyed when it ends */
+    TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+
+    /* Handle of the per-frame sampling callback */
+    FDelegateHandle PostTickHandle;
+
+    /* Fixed timestep settings to restore afterwards */
+    bool bPreviousUseFixedTimeStep = false;
+    double PreviousFixedDeltaTime = 0.0;
+
+    /* Used physical memory before spawning */
+    uint64 StartUsedMemory = 0;
+
+    /* Values at the previous sample */
+    double LastSampleTime = 0.0;
+    uint64 LastCycles[FSurvivalDebugTimers::NumTimers] = {};
+
+    /* Ambient ticks per significance bucket before the run */
+    uint64 StartTickCounts[UAmbientSignificanceSubsystem::NumBuckets] = {};
+
+    /* Per-frame samples in milliseconds */
+    TArray<float> FrameSamples;
+    TArray<float> SystemSamples[FSurvivalDebugTimers::NumTimers];
+
+    /* Spawns every population on a grid around the world origin */
+    void SpawnPopulations();
+
+    /* Records one frame of samples */
+    void OnPostActorTick(UWorld* TickedWorld, ELevelTick TickType, float DeltaSeconds);
+
+    /**
+     * @brief Writes the report and checks the thresholds
+     * @return True if every threshold was met
+     */
+    bool Report() const;
+};
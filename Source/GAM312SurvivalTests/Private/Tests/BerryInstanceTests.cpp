@@ -0,0 +1,86 @@
+#include "Tests/SurvivalTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "BerryBush.h"
+#include "BerryInstanceSubsystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBerryInstanceGrowthTest, "GAM312Survival.Berries.InstancedGrowth",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBerryInstanceGrowthTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumBushes = 16;
+    constexpr int32 NumCollected = 4;
+
+    UStaticMesh* BerryMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+    if (!TestNotNull(TEXT("Berry mesh"), BerryMesh)) return false;
+
+    FSurvivalTestWorld TestWorld;
+    UWorld* World = TestWorld.Get();
+    UBerryInstanceSubsystem* InstanceSubsystem = World->GetSubsystem<UBerryInstanceSubsystem>();
+    if (!TestNotNull(TEXT("Berry instance subsystem"), InstanceSubsystem)) return false;
+
+    // The instancing switch and the berry component are editor-facing, so set them like the editor does
+    const FBoolProperty* InstancedProperty = FindFProperty<FBoolProperty>(ABerryBush::StaticClass(), TEXT("bUseInstancedBerries"));
+    const FObjectProperty* BerryMeshProperty = FindFProperty<FObjectProperty>(ABerryBush::StaticClass(), TEXT("BerryMesh"));
+    if (!TestNotNull(TEXT("bUseInstancedBerries property"), InstancedProperty) || !TestNotNull(TEXT("BerryMesh property"), BerryMeshProperty)) return false;
+
+    TArray<ABerryBush*> Bushes;
+    for (int32 i = 0; i < NumBushes; ++i)
+    {
+        const FTransform Transform(FVector(i * 300.0f, 0.0f, 0.0f));
+        ABerryBush* Bush = World->SpawnActorDeferred<ABerryBush>(ABerryBush::StaticClass(), Transform);
+        InstancedProperty->SetPropertyValue_InContainer(Bush, true);
+        CastChecked<UStaticMeshComponent>(BerryMeshProperty->GetObjectPropertyValue_InContainer(Bush))->SetStaticMesh(BerryMesh);
+        Bush->FinishSpawning(Transform);
+        Bushes.Add(Bush);
+    }
+
+    // Instances are handed out in spawn order in a fresh world, in the batch of the mesh's own material
+    UMaterialInterface* BerryMaterial = BerryMesh->GetMaterial(0);
+    auto GetGrowth = [InstanceSubsystem, BerryMesh, BerryMaterial](int32 BushIndex)
+    {
+        FBerryInstanceHandle Handle;
+        Handle.Mesh = BerryMesh;
+        Handle.Material = BerryMaterial;
+        Handle.InstanceIndex = BushIndex;
+        return InstanceSubsystem->GetInstanceGrowth(Handle);
+    };
+
+    TestEqual(TEXT("Instances after spawning"), InstanceSubsystem->GetInstanceCount(BerryMesh, BerryMaterial), NumBushes);
+    for (int32 i = 0; i < NumBushes; ++i)
+    {
+        TestEqual(FString::Printf(TEXT("Growth of ripe bush %d"), i), GetGrowth(i), 1.0f);
+    }
+
+    for (int32 i = 0; i < NumCollected; ++i)
+    {
+        Bushes[i]->CollectBerry();
+    }
+
+    TestEqual(TEXT("Instances after collecting"), InstanceSubsystem->GetInstanceCount(BerryMesh, BerryMaterial), NumBushes);
+    for (int32 i = 0; i < NumBushes; ++i)
+    {
+        TestEqual(FString::Printf(TEXT("Growth of bush %d after collecting"), i), GetGrowth(i), i < NumCollected ? 0.0f : 1.0f);
+    }
+
+    // Half way lands exactly on a visual step
+    Bushes[0]->ApplyRegrowthProgress(0.5f);
+    TestEqual(TEXT("Growth half way through regrowth"), GetGrowth(0), 0.5f);
+
+    Bushes[0]->ApplyRegrowthProgress(1.0f);
+    TestEqual(TEXT("Growth after regrowth"), GetGrowth(0), 1.0f);
+    TestFalse(TEXT("Regrown bush can be collected again"), Bushes[0]->bIsCollected);
+
+    // Bushes leaving play release their instance
+    Bushes.Last()->Destroy();
+    TestEqual(TEXT("Instances after destroying a bush"), InstanceSubsystem->GetInstanceCount(BerryMesh, BerryMaterial), NumBushes - 1);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "Tests/SurvivalTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "PlayerCharacter.h"
+#include "PlayerStatsWidget.h"
+#include "SurvivalStatsComponent.h"
+#include "Blueprint/UserWidget.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayerStatsWidgetIdleTest, "GAM312Survival.UI.StatsWidgetIdleRefreshes",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPlayerStatsWidgetIdleTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumFrames = 600;
+    constexpr float DeltaSeconds = 1.0f / 60.0f;
+
+    FSurvivalTestWorld TestWorld;
+    UWorld* World = TestWorld.Get();
+
+    // Stop hunger decay before the stats register, so nothing changes while idle
+    const FTransform Transform = FTransform::Identity;
+    APlayerCharacter* Player = World->SpawnActorDeferred<APlayerCharacter>(APlayerCharacter::StaticClass(), Transform);
+    if (!TestNotNull(TEXT("Player character"), Player)) return false;
+    USurvivalStatsComponent* Stats = Player->GetStatsComponent();
+    Stats->HungerDecayRate = 0.0f;
+    Player->FinishSpawning(Transform);
+
+    UPlayerStatsWidget* Widget = CreateWidget<UPlayerStatsWidget>(World, UPlayerStatsWidget::StaticClass());
+    if (!TestNotNull(TEXT("Stats widget"), Widget)) return false;
+    Widget->BindToCharacter(Player);
+    TestEqual(TEXT("Refreshes when bound"), Widget->GetNumRefreshes(), 3);
+
+    // Full health and stamina with no decay, the texts must not be rebuilt
+    int32 StartRefreshes = Widget->GetNumRefreshes();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        TestWorld.Tick(DeltaSeconds);
+    }
+    TestEqual(TEXT("Refreshes over idle frames"), Widget->GetNumRefreshes() - StartRefreshes, 0);
+
+    // Decaying hunger only refreshes once per change quantum, not once per frame
+    Stats->SetRate(ESurvivalRate::HungerDecay, 1.0f);
+
+    StartRefreshes = Widget->GetNumRefreshes();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        TestWorld.Tick(DeltaSeconds);
+    }
+    const int32 MaxRefreshes = FMath::CeilToInt(NumFrames * DeltaSeconds * Stats->HungerDecayRate / Stats->StatChangeQuantum) + 1;
+    TestTrue(TEXT("Hunger refreshes bounded by the change quantum"), Widget->GetNumRefreshes() - StartRefreshes <= MaxRefreshes);
+
+    Widget->RemoveFromParent();
+    Player->Destroy();
+    return true;
+}
+
+#endif
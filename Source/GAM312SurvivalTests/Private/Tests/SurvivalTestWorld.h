@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+/**
+ * @class FSurvivalTestWorld
+ * @brief Game world that lives for the duration of an automation test
+ *
+ * The world is initialized for play, so world subsystems exist and spawned actors run
+ * BeginPlay, and it is destroyed again when the test scope ends.
+ */
+class FSurvivalTestWorld
+{
+public:
+    FSurvivalTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false);
+
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+    }
+
+    ~FSurvivalTestWorld()
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    FSurvivalTestWorld(const FSurvivalTestWorld&) = delete;
+    FSurvivalTestWorld& operator=(const FSurvivalTestWorld&) = delete;
+
+    /* The test world */
+    UWorld* Get() const { return World; }
+
+    /**
+     * @brief Simulates one frame
+     * @param DeltaSeconds - Length of the frame
+     */
+    void Tick(float DeltaSeconds)
+    {
+        // Timer managers only tick once per engine frame
+        ++GFrameCounter;
+        World->Tick(LEVELTICK_All, DeltaSeconds);
+    }
+
+private:
+    /* The test world */
+    UWorld* World = nullptr;
+};
+
+#endif
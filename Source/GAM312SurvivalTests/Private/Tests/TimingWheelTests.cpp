@@ -0,0 +1,71 @@
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "TimingWheel.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimingWheelLevelBoundaryTest, "GAM312Survival.TimingWheel.LevelBoundaries",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTimingWheelLevelBoundaryTest::RunTest(const FString& Parameters)
+{
+    // Same layout as the respawn wheel: 64 one second slots per level, levels spanning 64, 4096 and 262144 ticks
+    constexpr int32 NumSlots = 64;
+    constexpr int32 TopSpan = NumSlots * NumSlots * NumSlots;
+    TTimingWheel<int32> Wheel(1.0f, NumSlots, 3);
+
+    // Delays on both sides of every level boundary and past the top level's span
+    const TArray<int32> Delays = { 1, 63, 64, 65, 4095, 4096, 4097, TopSpan - 1, TopSpan, TopSpan + 1, TopSpan + 4097, 2 * TopSpan + 63 };
+
+    TArray<int64> DueTicks;
+    TArray<int64> FiredTicks;
+    TArray<int32> FireCounts;
+    auto ScheduleAll = [&](int64 CurrentTick)
+    {
+        for (const int32 Delay : Delays)
+        {
+            Wheel.Schedule(DueTicks.Num(), Delay);
+            DueTicks.Add(CurrentTick + Delay);
+            FiredTicks.Add(INDEX_NONE);
+            FireCounts.Add(0);
+        }
+    };
+
+    // Once from a tick aligned with every level, and once from a tick that is not aligned with any
+    constexpr int64 UnalignedTick = 37;
+    ScheduleAll(0);
+
+    int64 LastDueTick = 0;
+    for (const int32 Delay : Delays)
+    {
+        LastDueTick = FMath::Max<int64>(LastDueTick, UnalignedTick + Delay);
+    }
+
+    for (int64 Tick = 1; Tick <= LastDueTick + 1; ++Tick)
+    {
+        Wheel.Advance(1.0f, [&](int32 Element)
+        {
+            FiredTicks[Element] = Tick;
+            ++FireCounts[Element];
+        });
+
+        if (Tick == UnalignedTick)
+        {
+            ScheduleAll(Tick);
+        }
+    }
+
+    for (int32 i = 0; i < DueTicks.Num(); ++i)
+    {
+        const int64 ScheduledTick = DueTicks[i] - Delays[i % Delays.Num()];
+        const FString What = FString::Printf(TEXT("Element delayed %d ticks from tick %lld"), Delays[i % Delays.Num()], ScheduledTick);
+        TestEqual(What + TEXT(" fire count"), FireCounts[i], 1);
+        TestEqual(What + TEXT(" fired on"), FiredTicks[i], DueTicks[i]);
+    }
+    TestEqual(TEXT("Elements left in the wheel"), Wheel.Num(), 0);
+
+    return true;
+}
+
+#endif